@@ -0,0 +1,119 @@
+#include <swiftchannel/sender/ring_buffer.hpp>
+#include <swiftchannel/common/checksum.hpp>
+#include <swiftchannel/common/types.hpp>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+using namespace swiftchannel;
+
+// Cost of CRC32C payload checksums
+// Sends each message through a RingBuffer and reads it back on the same
+// thread, once with ChannelFlags::Checksum and once without, and reports
+// the extra time per GB of payload. Single-threaded on purpose: this is the
+// CPU cost of computing and verifying, not of cache-line transfer.
+
+namespace {
+
+double round_trip_seconds(size_t message_size, uint64_t volume, uint64_t flags) {
+    constexpr size_t ring_size = 1024 * 1024;
+    const size_t header_size = align_up(sizeof(SharedMemoryHeader), CACHE_LINE_SIZE);
+    void* memory = ::operator new(header_size + ring_size, std::align_val_t{CACHE_LINE_SIZE});
+    std::memset(memory, 0, header_size + ring_size);
+
+    auto* header = static_cast<SharedMemoryHeader*>(memory);
+    void* ring_memory = static_cast<uint8_t*>(memory) + header_size;
+
+    RingBuffer producer(ring_memory, ring_size, flags);
+    RingBuffer consumer(ring_memory, ring_size, flags);
+    std::vector<uint8_t> payload(message_size, 0x5A);
+    std::vector<uint8_t> buffer(message_size);
+
+    // Keep a few messages in flight so reads come from a warm ring
+    constexpr uint64_t in_flight = 8;
+    const uint64_t count = std::max<uint64_t>(volume / message_size, 10000);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t sent = 0; sent < count; sent += in_flight) {
+        for (uint64_t i = 0; i < in_flight; ++i) {
+            payload[0] = static_cast<uint8_t>(sent + i);
+            [[maybe_unused]] bool written =
+                producer.try_write(payload.data(), payload.size(), header);
+        }
+        for (uint64_t i = 0; i < in_flight; ++i) {
+            size_t size = buffer.size();
+            [[maybe_unused]] bool read = consumer.try_read(buffer.data(), size, header);
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    if (consumer.checksum_mismatches() != 0) {
+        std::cerr << "unexpected checksum mismatches\n";
+    }
+
+    ::operator delete(memory, std::align_val_t{CACHE_LINE_SIZE});
+
+    // Normalise to exactly one GB of payload
+    const double bytes = static_cast<double>(count / in_flight * in_flight) *
+                         static_cast<double>(message_size);
+    return std::chrono::duration<double>(end - start).count() * 1e9 / bytes;
+}
+
+// Plain copy vs. fused copy + CRC32C, seconds per GB
+double copy_seconds(size_t size, uint64_t volume, bool with_crc) {
+    std::vector<uint8_t> src(size, 0x5A);
+    std::vector<uint8_t> dst(size);
+    const uint64_t count = std::max<uint64_t>(volume / size, 10000);
+
+    uint32_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < count; ++i) {
+        src[0] = static_cast<uint8_t>(i);
+        if (with_crc) {
+            sink ^= copy_crc32c(dst.data(), src.data(), size);
+        } else {
+            std::memcpy(dst.data(), src.data(), size);
+            sink ^= dst[size - 1];
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    if (sink == 0xFFFFFFFF) {
+        std::cout << "";  // Keep the loop from being optimised away
+    }
+    return std::chrono::duration<double>(end - start).count() * 1e9 /
+           (static_cast<double>(count) * static_cast<double>(size));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // Optional argument: bytes of payload per measurement
+    const uint64_t volume = (argc > 1) ? std::strtoull(argv[1], nullptr, 10)
+                                       : 1ull << 30;  // 1 GiB
+    const auto checksum = static_cast<uint64_t>(ChannelFlags::Checksum);
+
+    std::cout << "SwiftChannel checksum cost (CRC32C, ms per GB of payload)\n";
+    std::cout << std::setw(10) << "size"
+              << std::setw(12) << "copy" << std::setw(12) << "copy+crc"
+              << std::setw(12) << "ring off" << std::setw(12) << "ring on"
+              << std::setw(12) << "overhead" << "\n";
+
+    for (size_t message_size : {64, 256, 1024, 4096, 16384, 65536}) {
+        const double copy = copy_seconds(message_size, volume, false);
+        const double copy_crc = copy_seconds(message_size, volume, true);
+        const double off = round_trip_seconds(message_size, volume, 0);
+        const double on = round_trip_seconds(message_size, volume, checksum);
+
+        std::cout << std::setw(10) << message_size << std::fixed << std::setprecision(1)
+                  << std::setw(12) << copy * 1e3 << std::setw(12) << copy_crc * 1e3
+                  << std::setw(12) << off * 1e3 << std::setw(12) << on * 1e3
+                  << std::setw(11) << (on - off) * 1e3 << "\n";
+    }
+
+    return 0;
+}
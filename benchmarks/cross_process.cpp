@@ -0,0 +1,502 @@
+#include <swiftchannel/swiftchannel.hpp>
+#include <swiftchannel/receiver/receiver.hpp>
+#include <swiftchannel/common/timestamp.hpp>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace swiftchannel;
+
+// Cross-process latency and throughput
+// Forks a sender and a receiver process, each pinned to its own core, and
+// measures what a deployment across processes sees:
+//   one-way   send-to-handler latency from MessageHeader::timestamp, with
+//             the sender paced at each target rate, and at full speed for
+//             the maximum sustained throughput
+//   ping-pong round trip over a pair of channels, one message in flight
+// Latencies go into an HDR-style histogram; p50/p99/p99.9/p99.99/max are
+// reported. Options:
+//   --sender-cpu N --receiver-cpu N   cores to pin to (-1: unpinned)
+//   --size B         message size (at least 8)
+//   --rates R,R,...  target rates in msgs/s
+//   --seconds S      length of each one-way run
+//   --round-trips N  ping-pong exchanges
+// Both channels use blocking_wait, so the processes still make progress
+// when they share a core (latencies then reflect the scheduler).
+
+namespace {
+
+constexpr uint64_t STOP = ~0ull;         // Sequence that ends a run
+constexpr uint64_t WARMUP = 1000;        // Leading samples not recorded
+constexpr uint64_t SPIN_NS = 50000;      // Pacing sleeps until this close, then spins
+
+// Log-linear histogram of nanosecond values, HdrHistogram style
+// Values below 2 * HALF are counted exactly; each power-of-2 range above is
+// split into HALF buckets, so a value is recorded within 1 / HALF (< 1%).
+class Histogram {
+public:
+    static constexpr unsigned SUB_BITS = 8;
+    static constexpr uint64_t HALF = 1ull << (SUB_BITS - 1);
+
+    Histogram() : counts_((64 - SUB_BITS + 2) * HALF, 0) {}
+
+    void record(uint64_t value) {
+        ++counts_[index(value)];
+        ++total_;
+        sum_ += value;
+        max_ = std::max(max_, value);
+    }
+
+    // Smallest recorded value at or above percent of all samples (bucket
+    // upper bound, capped at the maximum)
+    uint64_t percentile(double percent) const {
+        const auto target = static_cast<uint64_t>(
+            std::ceil(percent / 100.0 * static_cast<double>(total_)));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= std::max<uint64_t>(target, 1)) {
+                return std::min(highest(i), max_);
+            }
+        }
+        return max_;
+    }
+
+    uint64_t count() const { return total_; }
+    uint64_t max() const { return max_; }
+    double mean() const {
+        return total_ ? static_cast<double>(sum_) / static_cast<double>(total_) : 0.0;
+    }
+
+private:
+    static size_t index(uint64_t value) {
+        const unsigned width = static_cast<unsigned>(std::bit_width(value));
+        const unsigned shift = width > SUB_BITS ? width - SUB_BITS : 0;
+        return shift * HALF + static_cast<size_t>(value >> shift);
+    }
+
+    static uint64_t highest(size_t index) {
+        const uint64_t shift = index < 2 * HALF ? 0 : index / HALF - 1;
+        const uint64_t lowest = (index - shift * HALF) << shift;
+        return lowest + (1ull << shift) - 1;
+    }
+
+    std::vector<uint64_t> counts_;
+    uint64_t total_ = 0;
+    uint64_t sum_ = 0;
+    uint64_t max_ = 0;
+};
+
+// What a child process reports back through its pipe
+struct Summary {
+    uint64_t count;      // Messages received (or round trips)
+    uint64_t elapsed_ns; // First to last
+    double mean_ns;
+    uint64_t p50_ns;
+    uint64_t p99_ns;
+    uint64_t p999_ns;
+    uint64_t p9999_ns;
+    uint64_t max_ns;
+};
+
+Summary summarize(const Histogram& histogram, uint64_t count, uint64_t elapsed_ns) {
+    return Summary{count, elapsed_ns, histogram.mean(),
+                   histogram.percentile(50.0), histogram.percentile(99.0),
+                   histogram.percentile(99.9), histogram.percentile(99.99),
+                   histogram.max()};
+}
+
+struct Options {
+    int sender_cpu = 0;
+    int receiver_cpu = 1;
+    size_t size = 64;
+    std::vector<uint64_t> rates = {10000, 100000, 1000000};
+    double seconds = 1.0;
+    uint64_t round_trips = 100000;
+};
+
+ChannelConfig channel_config(const Options& options) {
+    ChannelConfig config;
+    config.ring_buffer_size = 1024 * 1024;
+    config.max_message_size = std::max<size_t>(std::bit_ceil(options.size), 64);
+    config.blocking_wait = true;
+    return config;
+}
+
+// Pin the calling process to cpu (-1 leaves it unpinned)
+void pin(int cpu, const char* role) {
+    if (cpu < 0) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (::sched_setaffinity(0, sizeof(set), &set) != 0) {
+        std::cerr << "warning: cannot pin " << role << " to cpu " << cpu
+                  << " (" << std::strerror(errno) << "), running unpinned\n";
+    }
+}
+
+// The library leaves channels in place; drop the ones a run created
+// (POSIX shared memory, named as in shm_posix.cpp)
+void remove_channel(const std::string& name) {
+    ::shm_unlink(("/swiftchannel_" + name).c_str());
+}
+
+// Sleep, then spin, until the steady clock reaches deadline_ns
+void pace_until(uint64_t deadline_ns) {
+    uint64_t now = steady_now_ns();
+    if (deadline_ns > now + SPIN_NS) {
+        const uint64_t nap = deadline_ns - now - SPIN_NS;
+        timespec ts{static_cast<time_t>(nap / 1000000000ull),
+                    static_cast<long>(nap % 1000000000ull)};
+        ::nanosleep(&ts, nullptr);
+    }
+    while (steady_now_ns() < deadline_ns) {}
+}
+
+void write_all(int fd, const void* data, size_t size) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    while (size != 0) {
+        const ssize_t written = ::write(fd, bytes, size);
+        if (written <= 0) {
+            return;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+bool read_all(int fd, void* data, size_t size) {
+    auto* bytes = static_cast<uint8_t*>(data);
+    while (size != 0) {
+        const ssize_t got = ::read(fd, bytes, size);
+        if (got <= 0) {
+            return false;
+        }
+        bytes += got;
+        size -= static_cast<size_t>(got);
+    }
+    return true;
+}
+
+// A forked child and the pipe it reports through
+struct Child {
+    pid_t pid;
+    int fd;
+};
+
+// Run body(report_fd) in a child process, exiting with what it returns
+template<typename Body>
+Child fork_child(Body&& body) {
+    int fds[2];
+    if (::pipe(fds) != 0) {
+        std::perror("pipe");
+        std::exit(1);
+    }
+    std::cout.flush();  // Or the child prints it again
+    const pid_t pid = ::fork();
+    if (pid < 0) {
+        std::perror("fork");
+        std::exit(1);
+    }
+    if (pid == 0) {
+        ::close(fds[0]);
+        ::_exit(body(fds[1]));
+    }
+    ::close(fds[1]);
+    return Child{pid, fds[0]};
+}
+
+// Read what the child reports, then reap it; false if it failed
+template<typename T>
+bool finish(Child child, T& result) {
+    const bool ok = read_all(child.fd, &result, sizeof(result));
+    ::close(child.fd);
+    int status = 0;
+    ::waitpid(child.pid, &status, 0);
+    return ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+// One-way run: the receiver records send-to-handler latency; the sender
+// sends at rate msgs/s (0 = as fast as the channel takes them)
+bool one_way(const Options& options, const std::string& name, uint64_t rate, Summary& summary) {
+    const ChannelConfig config = channel_config(options);
+
+    Child receiver = fork_child([&](int report) {
+        pin(options.receiver_cpu, "receiver");
+        Receiver channel(name, config);
+        const char ready = 1;
+        write_all(report, &ready, 1);
+
+        Histogram histogram;
+        uint64_t received = 0;
+        uint64_t first_ns = 0;
+        uint64_t last_ns = 0;
+        auto result = channel.run([&](const void* data, size_t) {
+            const uint64_t now = steady_now_ns();
+            uint64_t sequence = 0;
+            std::memcpy(&sequence, data, sizeof(sequence));
+            if (sequence == STOP) {
+                channel.stop();
+                return;
+            }
+            if (received++ == 0) {
+                first_ns = now;
+            }
+            last_ns = now;
+            if (sequence >= WARMUP) {
+                histogram.record(now - channel.last_timestamp_ns());
+            }
+        });
+        const Summary report_summary = summarize(histogram, received, last_ns - first_ns);
+        write_all(report, &report_summary, sizeof(report_summary));
+        return result.is_ok() ? 0 : 1;
+    });
+
+    char ready = 0;
+    if (!read_all(receiver.fd, &ready, 1)) {
+        finish(receiver, summary);
+        return false;
+    }
+
+    Child sender = fork_child([&](int) {
+        pin(options.sender_cpu, "sender");
+        Sender channel(name, config);
+        std::vector<uint8_t> payload(options.size, 0x5A);
+
+        const uint64_t duration_ns = static_cast<uint64_t>(options.seconds * 1e9);
+        const uint64_t interval_ns = rate ? 1000000000ull / rate : 0;
+        const uint64_t start = steady_now_ns();
+        for (uint64_t sequence = 0;; ++sequence) {
+            const uint64_t due = start + sequence * interval_ns;
+            if (rate != 0) {
+                pace_until(due);
+            }
+            if ((rate != 0 ? due : steady_now_ns()) - start >= duration_ns) {
+                break;
+            }
+            std::memcpy(payload.data(), &sequence, sizeof(sequence));
+            if (channel.send_blocking_bytes(payload.data(), payload.size()).is_error()) {
+                return 1;
+            }
+        }
+        std::memcpy(payload.data(), &STOP, sizeof(STOP));
+        return channel.send_blocking_bytes(payload.data(), payload.size()).is_ok() ? 0 : 1;
+    });
+
+    int status = 0;
+    ::waitpid(sender.pid, &status, 0);
+    ::close(sender.fd);
+    return finish(receiver, summary) && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+// Ping-pong run: the pinger times each round trip through an echoing peer
+bool ping_pong(const Options& options, const std::string& name, Summary& summary) {
+    const ChannelConfig config = channel_config(options);
+    const std::string ping = name + "_ping";
+    const std::string pong = name + "_pong";
+
+    Child echo = fork_child([&](int report) {
+        pin(options.receiver_cpu, "echo");
+        Receiver requests(ping, config);
+        const char ready = 1;
+        write_all(report, &ready, 1);
+
+        // The pinger creates pong before its first ping
+        std::unique_ptr<Sender> replies;
+        bool echoed = true;
+        auto result = requests.run([&](const void* data, size_t size) {
+            if (!replies) {
+                replies = std::make_unique<Sender>(pong, config);
+            }
+            uint64_t sequence = 0;
+            std::memcpy(&sequence, data, sizeof(sequence));
+            if (replies->send_blocking_bytes(data, size).is_error()) {
+                echoed = false;
+                sequence = STOP;
+            }
+            if (sequence == STOP) {
+                requests.stop();
+            }
+        });
+        return result.is_ok() && echoed ? 0 : 1;
+    });
+
+    char ready = 0;
+    const bool echo_ready = read_all(echo.fd, &ready, 1);
+    ::close(echo.fd);
+    if (!echo_ready) {
+        ::waitpid(echo.pid, nullptr, 0);
+        return false;
+    }
+
+    Child pinger = fork_child([&](int report) {
+        pin(options.sender_cpu, "pinger");
+        Receiver replies(pong, config);
+        Sender requests(ping, config);
+        std::vector<uint8_t> payload(options.size, 0x5A);
+
+        Histogram histogram;
+        const uint64_t total = options.round_trips + WARMUP;
+        uint64_t start = 0;
+        for (uint64_t sequence = 0; sequence <= total; ++sequence) {
+            const uint64_t value = sequence == total ? STOP : sequence;
+            std::memcpy(payload.data(), &value, sizeof(value));
+            const uint64_t sent = steady_now_ns();
+            if (sequence == WARMUP) {
+                start = sent;
+            }
+            if (requests.send_blocking_bytes(payload.data(), payload.size()).is_error()) {
+                return 1;
+            }
+            Result<bool> got(false);
+            while (got.is_ok() && !got.value()) {
+                got = replies.receive([](const void*, size_t) {});
+            }
+            if (got.is_error()) {
+                return 1;
+            }
+            if (sequence >= WARMUP && sequence != total) {
+                histogram.record(steady_now_ns() - sent);
+            }
+        }
+        const Summary result = summarize(histogram, histogram.count(), steady_now_ns() - start);
+        write_all(report, &result, sizeof(result));
+        return 0;
+    });
+
+    int status = 0;
+    ::waitpid(echo.pid, &status, 0);
+    const bool echo_ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    return finish(pinger, summary) && echo_ok;
+}
+
+void print_header() {
+    std::cout << std::left << std::setw(12) << "run" << std::right
+              << std::setw(12) << "msgs/s" << std::setw(10) << "mean"
+              << std::setw(10) << "p50" << std::setw(10) << "p99"
+              << std::setw(10) << "p99.9" << std::setw(10) << "p99.99"
+              << std::setw(10) << "max" << "   (latencies in us)\n";
+}
+
+void print_row(const std::string& run, const Summary& summary) {
+    const double seconds = static_cast<double>(summary.elapsed_ns) / 1e9;
+    const double rate = seconds > 0 ? static_cast<double>(summary.count) / seconds : 0.0;
+    auto us = [](double ns) { return ns / 1000.0; };
+    std::cout << std::left << std::setw(12) << run << std::right << std::fixed
+              << std::setprecision(0) << std::setw(12) << rate
+              << std::setprecision(2)
+              << std::setw(10) << us(summary.mean_ns)
+              << std::setw(10) << us(static_cast<double>(summary.p50_ns))
+              << std::setw(10) << us(static_cast<double>(summary.p99_ns))
+              << std::setw(10) << us(static_cast<double>(summary.p999_ns))
+              << std::setw(10) << us(static_cast<double>(summary.p9999_ns))
+              << std::setw(10) << us(static_cast<double>(summary.max_ns)) << "\n";
+}
+
+std::vector<uint64_t> parse_rates(const std::string& list) {
+    std::vector<uint64_t> rates;
+    size_t begin = 0;
+    while (begin <= list.size()) {
+        const size_t end = std::min(list.find(',', begin), list.size());
+        const uint64_t rate = std::strtoull(list.substr(begin, end - begin).c_str(), nullptr, 10);
+        if (rate != 0) {
+            rates.push_back(rate);
+        }
+        begin = end + 1;
+    }
+    return rates;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (value == nullptr) {
+            // Every option takes a value
+        } else if (arg == "--sender-cpu") {
+            options.sender_cpu = std::atoi(value);
+        } else if (arg == "--receiver-cpu") {
+            options.receiver_cpu = std::atoi(value);
+        } else if (arg == "--size") {
+            options.size = std::max<size_t>(std::strtoull(value, nullptr, 10), sizeof(uint64_t));
+        } else if (arg == "--rates") {
+            options.rates = parse_rates(value);
+        } else if (arg == "--seconds") {
+            options.seconds = std::atof(value);
+        } else if (arg == "--round-trips") {
+            options.round_trips = std::strtoull(value, nullptr, 10);
+        } else {
+            value = nullptr;
+        }
+        if (value == nullptr) {
+            std::cerr << "usage: " << argv[0] << " [--sender-cpu N] [--receiver-cpu N]"
+                      << " [--size B] [--rates R,R,...] [--seconds S] [--round-trips N]\n";
+            return 2;
+        }
+        ++i;
+    }
+
+    const std::string prefix = "xproc_" + std::to_string(::getpid()) + "_";
+    size_t runs = 0;
+    std::cout << "Cross-process benchmark: " << options.size << " B messages, sender on cpu "
+              << options.sender_cpu << ", receiver on cpu " << options.receiver_cpu << "\n\n";
+    print_header();
+
+    bool ok = true;
+    Summary summary{};
+    for (uint64_t rate : options.rates) {
+        const std::string name = prefix + std::to_string(runs++);
+        const bool done = one_way(options, name, rate, summary);
+        remove_channel(name);
+        if (done) {
+            print_row(std::to_string(rate), summary);
+        } else {
+            std::cerr << "one-way run at " << rate << " msgs/s failed\n";
+            ok = false;
+        }
+    }
+
+    std::string name = prefix + std::to_string(runs++);
+    bool done = one_way(options, name, 0, summary);
+    remove_channel(name);
+    if (done) {
+        print_row("max", summary);
+        const double seconds = static_cast<double>(summary.elapsed_ns) / 1e9;
+        std::cout << "  sustained: " << std::setprecision(3)
+                  << static_cast<double>(summary.count * options.size) / seconds / 1e9
+                  << " GB/s\n";
+    } else {
+        std::cerr << "maximum-throughput run failed\n";
+        ok = false;
+    }
+
+    name = prefix + std::to_string(runs++);
+    done = ping_pong(options, name, summary);
+    remove_channel(name + "_ping");
+    remove_channel(name + "_pong");
+    if (done) {
+        std::cout << "\n";
+        print_row("round trip", summary);
+    } else {
+        std::cerr << "ping-pong run failed\n";
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
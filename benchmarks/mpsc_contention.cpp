@@ -0,0 +1,98 @@
+#include <swiftchannel/sender/ring_buffer.hpp>
+#include <swiftchannel/common/types.hpp>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+using namespace swiftchannel;
+
+// MPSC contention benchmark
+// N producer threads write into one multi-producer RingBuffer while a single
+// consumer drains it. Each producer has its own RingBuffer instance, as each
+// process would, so the only shared state is the header and the ring.
+
+namespace {
+
+double run(size_t ring_size, size_t message_size, int producers, uint64_t per_producer) {
+    const size_t header_size = align_up(sizeof(SharedMemoryHeader), CACHE_LINE_SIZE);
+    void* memory = ::operator new(header_size + ring_size, std::align_val_t{CACHE_LINE_SIZE});
+    std::memset(memory, 0, header_size + ring_size);
+
+    auto* header = static_cast<SharedMemoryHeader*>(memory);
+    void* ring_memory = static_cast<uint8_t*>(memory) + header_size;
+    const auto flags = static_cast<uint64_t>(ChannelFlags::MultiProducer);
+
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&]() {
+            RingBuffer rb(ring_memory, ring_size, flags);
+            std::vector<uint8_t> payload(message_size, 0xAB);
+            while (!go.load(std::memory_order_acquire)) {}
+
+            for (uint64_t sent = 0; sent < per_producer;) {
+                if (rb.try_write(payload.data(), payload.size(), header)) {
+                    ++sent;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    RingBuffer consumer(ring_memory, ring_size, flags);
+    const uint64_t total = per_producer * static_cast<uint64_t>(producers);
+
+    go.store(true, std::memory_order_release);
+    const auto start = std::chrono::steady_clock::now();
+
+    for (uint64_t received = 0; received < total;) {
+        const size_t count = consumer.read_batch(256, [](std::span<const uint8_t>) {}, header);
+        if (count != 0) {
+            received += count;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    const auto end = std::chrono::steady_clock::now();
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    ::operator delete(memory, std::align_val_t{CACHE_LINE_SIZE});
+
+    return static_cast<double>(total) / std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // Optional argument: messages per producer
+    const uint64_t per_producer = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    constexpr size_t ring_size = 1024 * 1024;
+
+    std::cout << "SwiftChannel MPSC contention (ring " << ring_size / 1024 << " KiB, "
+              << per_producer << " msgs/producer)\n";
+    std::cout << std::setw(10) << "producers" << std::setw(10) << "size"
+              << std::setw(14) << "Mmsg/s" << std::setw(12) << "ns/msg" << "\n";
+
+    for (int producers : {1, 2, 4, 8, 16}) {
+        for (size_t message_size : {16, 256}) {
+            const double msgs_per_sec = run(ring_size, message_size, producers, per_producer);
+
+            std::cout << std::setw(10) << producers << std::setw(10) << message_size
+                      << std::setw(14) << std::fixed << std::setprecision(2) << msgs_per_sec / 1e6
+                      << std::setw(12) << std::setprecision(1) << 1e9 / msgs_per_sec << "\n";
+        }
+    }
+
+    return 0;
+}
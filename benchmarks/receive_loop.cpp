@@ -0,0 +1,100 @@
+#include <swiftchannel/swiftchannel.hpp>
+#include <swiftchannel/receiver/receiver.hpp>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstring>
+#include <string>
+
+using namespace swiftchannel;
+
+// Receive loop cost: std::function handlers vs. inlined templates
+// The ring is filled up front and then drained, so only the consumer side
+// is timed. Compares poll_one (std::function, through the pImpl) with
+// poll<Handler>, and drain with run<Handler>, on the same channel.
+
+namespace {
+
+constexpr size_t MESSAGE_SIZE = 16;
+constexpr int ROUNDS = 200;
+
+// Fill the ring; returns how many messages went in
+size_t fill(Sender& sender) {
+    uint8_t message[MESSAGE_SIZE] = {};
+    size_t count = 0;
+    while (sender.send_bytes(message, sizeof(message)).is_ok()) {
+        ++count;
+    }
+    return count;
+}
+
+template<typename Consume>
+double measure(Sender& sender, Consume&& consume) {
+    double total_ns = 0;
+    size_t total_messages = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        const size_t count = fill(sender);
+        const auto start = std::chrono::steady_clock::now();
+        consume(count);
+        total_ns += std::chrono::duration<double, std::nano>(
+            std::chrono::steady_clock::now() - start).count();
+        total_messages += count;
+    }
+    return total_ns / static_cast<double>(total_messages);
+}
+
+} // namespace
+
+int main() {
+    ChannelConfig config;
+    config.ring_buffer_size = 1024 * 1024;
+    config.max_message_size = 1024;
+
+    const std::string name = "bench_receive_loop";
+    Receiver receiver(name, config);
+    Sender sender(name, config);
+    while (receiver.drain(1 << 20, [](const void*, size_t) {}).value_or(0) != 0) {}
+
+    uint64_t sum = 0;
+    auto handle = [&sum](const void* data, size_t size) {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(word));
+        sum += word + size;
+    };
+
+    const double poll_one_ns = measure(sender, [&](size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            [[maybe_unused]] auto result = receiver.poll_one(handle);
+        }
+    });
+
+    const double poll_ns = measure(sender, [&](size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            [[maybe_unused]] auto result = receiver.poll(handle);
+        }
+    });
+
+    const double drain_ns = measure(sender, [&](size_t count) {
+        while (count != 0) {
+            count -= receiver.drain(256, handle).value_or(size_t{count});
+        }
+    });
+
+    const double run_ns = measure(sender, [&](size_t count) {
+        [[maybe_unused]] auto result = receiver.run([&](const void* data, size_t size) {
+            handle(data, size);
+            if (--count == 0) {
+                receiver.stop();
+            }
+        });
+    });
+
+    std::cout << "Receive loop, " << MESSAGE_SIZE << "-byte messages (ns/message)\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  poll_one (std::function): " << std::setw(7) << poll_one_ns << "\n";
+    std::cout << "  poll<Handler>:            " << std::setw(7) << poll_ns << "\n";
+    std::cout << "  drain (std::function):    " << std::setw(7) << drain_ns << "\n";
+    std::cout << "  run<Handler>:             " << std::setw(7) << run_ns << "\n";
+    std::cout << "  (checksum " << sum << ")\n";
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <swiftchannel/sender/ring_buffer.hpp>
+#include <swiftchannel/common/types.hpp>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <algorithm>
+#include <span>
+
+using namespace swiftchannel;
+
+// SPSC throughput benchmark
+// One producer thread and one consumer thread share a RingBuffer laid out
+// exactly like a channel (header followed by the ring). This isolates the
+// cost of the ring protocol itself, including cache-line traffic between the
+// two cores, without shared memory setup or handshakes.
+
+namespace {
+
+struct Result {
+    double seconds;
+    uint64_t messages;
+    size_t message_size;
+};
+
+// batch > 1 publishes that many messages per write_index store
+Result run(size_t ring_size, size_t message_size, uint64_t message_count, size_t batch) {
+    const size_t header_size = align_up(sizeof(SharedMemoryHeader), CACHE_LINE_SIZE);
+    void* memory = ::operator new(header_size + ring_size, std::align_val_t{CACHE_LINE_SIZE});
+    std::memset(memory, 0, header_size + ring_size);
+
+    auto* header = static_cast<SharedMemoryHeader*>(memory);
+    header->write_index.store(0, std::memory_order_relaxed);
+    header->read_index.store(0, std::memory_order_relaxed);
+    void* ring_memory = static_cast<uint8_t*>(memory) + header_size;
+
+    std::atomic<bool> go{false};
+
+    std::thread consumer([&]() {
+        RingBuffer rb(ring_memory, ring_size);
+        std::vector<uint8_t> buffer(message_size);
+        while (!go.load(std::memory_order_acquire)) {}
+
+        uint64_t received = 0;
+        while (received < message_count) {
+            size_t size = buffer.size();
+            if (rb.try_read(buffer.data(), size, header)) {
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    RingBuffer rb(ring_memory, ring_size);
+    std::vector<uint8_t> payload(message_size, 0xAB);
+
+    go.store(true, std::memory_order_release);
+    const auto start = std::chrono::steady_clock::now();
+
+    auto payload_at = [&](size_t) {
+        return std::span<const uint8_t>(payload.data(), payload.size());
+    };
+
+    for (uint64_t sent = 0; sent < message_count;) {
+        size_t written = 0;
+        if (batch > 1) {
+            const size_t n = static_cast<size_t>(std::min<uint64_t>(batch, message_count - sent));
+            written = rb.try_write_batch(n, payload_at, header);
+        } else {
+            written = rb.try_write(payload.data(), payload.size(), header) ? 1 : 0;
+        }
+
+        if (written != 0) {
+            sent += written;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+    const auto end = std::chrono::steady_clock::now();
+
+    ::operator delete(memory, std::align_val_t{CACHE_LINE_SIZE});
+
+    return {std::chrono::duration<double>(end - start).count(), message_count, message_size};
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // Optional argument: bytes of payload to move per message size
+    const uint64_t volume = (argc > 1) ? std::strtoull(argv[1], nullptr, 10)
+                                       : 1ull << 30;  // 1 GiB
+    constexpr size_t ring_size = 1024 * 1024;
+
+    std::cout << "SwiftChannel SPSC throughput (ring " << ring_size / 1024 << " KiB)\n";
+    std::cout << std::setw(10) << "size" << std::setw(8) << "batch" << std::setw(14) << "Mmsg/s"
+              << std::setw(12) << "GB/s" << std::setw(12) << "ns/msg" << "\n";
+
+    for (size_t batch : {1, 64}) {
+        for (size_t message_size : {8, 16, 64, 256, 1024, 4096, 16384}) {
+            const uint64_t count = std::max<uint64_t>(volume / message_size, 100000);
+            const Result r = run(ring_size, message_size, count, batch);
+
+            const double msgs_per_sec = static_cast<double>(r.messages) / r.seconds;
+            const double gb_per_sec = msgs_per_sec * static_cast<double>(r.message_size) / 1e9;
+
+            std::cout << std::setw(10) << message_size << std::setw(8) << batch
+                      << std::setw(14) << std::fixed << std::setprecision(2) << msgs_per_sec / 1e6
+                      << std::setw(12) << std::setprecision(3) << gb_per_sec
+                      << std::setw(12) << std::setprecision(1) << 1e9 / msgs_per_sec << "\n";
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,280 @@
+#include <swiftchannel/swiftchannel.hpp>
+#include <swiftchannel/receiver/receiver.hpp>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+using namespace swiftchannel;
+
+// Microbenchmark harness for regression tracking
+// Sweeps message sizes (8 B - 64 KB) and ring sizes over four single-thread
+// operations and reports ns/op, msgs/s and GB/s:
+//   ring_try_write / ring_try_read  RingBuffer on plain memory
+//   sender_send_bytes               Sender into a shared-memory channel
+//   receiver_poll_one               Receiver::poll_one out of that channel
+// Only the named operation is timed: the ring is filled or emptied by the
+// other side between timed stretches. Pass --json FILE to also write the
+// results as JSON (for diffing across versions), --min-ms N to change the
+// time spent per case (default 200).
+
+namespace {
+
+constexpr size_t MESSAGE_SIZES[] = {8, 64, 512, 4096, 65536};
+constexpr size_t RING_SIZES[] = {64 * 1024, 1024 * 1024, 16 * 1024 * 1024};
+constexpr size_t MAX_MESSAGE_SIZE = 64 * 1024;
+
+// Messages per timed stretch (fewer if the ring holds fewer)
+constexpr size_t STRETCH = 1024;
+
+struct Sample {
+    std::string benchmark;
+    size_t message_size;
+    size_t ring_size;
+    uint64_t ops;
+    double ns_per_op;
+
+    double msgs_per_sec() const {
+        return 1e9 / ns_per_op;
+    }
+
+    double gb_per_sec() const {
+        return msgs_per_sec() * static_cast<double>(message_size) / 1e9;
+    }
+};
+
+uint64_t now_ns() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Run round(timed_ns) until min_ns of timed work has piled up
+// round performs one stretch, adds the nanoseconds it timed and returns
+// the number of timed operations.
+template<typename Round>
+Sample measure(const char* name, size_t message_size, size_t ring_size, uint64_t min_ns,
+               Round&& round) {
+    uint64_t timed_ns = 0;
+    uint64_t ops = 0;
+    round(timed_ns);  // Warm up
+    timed_ns = 0;
+    while (timed_ns < min_ns) {
+        const size_t done = round(timed_ns);
+        if (done == 0) {
+            break;  // Nothing fits; report what was timed so far
+        }
+        ops += done;
+    }
+    return Sample{name, message_size, ring_size, ops,
+                  static_cast<double>(timed_ns) / static_cast<double>(std::max<uint64_t>(ops, 1))};
+}
+
+// Heap memory laid out like a channel: header, then the ring
+class LocalRing {
+public:
+    explicit LocalRing(size_t ring_size)
+        : header_size_(align_up(sizeof(SharedMemoryHeader), CACHE_LINE_SIZE))
+        , memory_(::operator new(header_size_ + ring_size, std::align_val_t{CACHE_LINE_SIZE}))
+        , producer_(ring(), ring_size)
+        , consumer_(ring(), ring_size)
+    {
+        std::memset(memory_, 0, header_size_ + ring_size);
+    }
+
+    ~LocalRing() {
+        ::operator delete(memory_, std::align_val_t{CACHE_LINE_SIZE});
+    }
+
+    SharedMemoryHeader* header() { return static_cast<SharedMemoryHeader*>(memory_); }
+    RingBuffer& producer() { return producer_; }
+    RingBuffer& consumer() { return consumer_; }
+
+private:
+    void* ring() { return static_cast<uint8_t*>(memory_) + header_size_; }
+
+    size_t header_size_;
+    void* memory_;
+    RingBuffer producer_;
+    RingBuffer consumer_;
+};
+
+void bench_ring(size_t message_size, size_t ring_size, size_t stretch, uint64_t min_ns,
+                std::vector<Sample>& samples, uint64_t& sink) {
+    LocalRing ring(ring_size);
+    std::vector<uint8_t> payload(message_size, 0x5A);
+    std::vector<uint8_t> buffer(message_size);
+    auto* header = ring.header();
+
+    auto fill = [&] {
+        size_t written = 0;
+        while (written < stretch &&
+               ring.producer().try_write(payload.data(), message_size, header)) {
+            ++written;
+        }
+        return written;
+    };
+    auto empty = [&] {
+        size_t read = 0;
+        for (size_t size = buffer.size(); ring.consumer().try_read(buffer.data(), size, header);
+             size = buffer.size()) {
+            sink += buffer[0];
+            ++read;
+        }
+        return read;
+    };
+
+    samples.push_back(measure("ring_try_write", message_size, ring_size, min_ns,
+        [&](uint64_t& timed_ns) {
+            const uint64_t start = now_ns();
+            const size_t written = fill();
+            timed_ns += now_ns() - start;
+            empty();
+            return written;
+        }));
+
+    samples.push_back(measure("ring_try_read", message_size, ring_size, min_ns,
+        [&](uint64_t& timed_ns) {
+            fill();
+            const uint64_t start = now_ns();
+            const size_t read = empty();
+            timed_ns += now_ns() - start;
+            return read;
+        }));
+}
+
+void bench_channel(size_t message_size, size_t ring_size, size_t stretch, uint64_t min_ns,
+                   std::vector<Sample>& samples, uint64_t& sink) {
+    ChannelConfig config;
+    config.ring_buffer_size = ring_size;
+    config.max_message_size = std::min(MAX_MESSAGE_SIZE, ring_size / 4);
+    if (message_size > config.max_message_size) {
+        return;
+    }
+
+    const std::string name = "bench_" + std::to_string(ring_size);
+    Receiver receiver(name, config);
+    Sender sender(name, config);
+    if (!sender.is_ready()) {
+        std::cerr << "Cannot open channel " << name << "\n";
+        return;
+    }
+    auto discard = [](const void*, size_t) {};
+    while (receiver.drain(1 << 20, discard).value_or(0) != 0) {}
+
+    std::vector<uint8_t> payload(message_size, 0x5A);
+    auto fill = [&] {
+        size_t sent = 0;
+        while (sent < stretch && sender.send_bytes(payload.data(), message_size).is_ok()) {
+            ++sent;
+        }
+        return sent;
+    };
+
+    samples.push_back(measure("sender_send_bytes", message_size, ring_size, min_ns,
+        [&](uint64_t& timed_ns) {
+            const uint64_t start = now_ns();
+            const size_t sent = fill();
+            timed_ns += now_ns() - start;
+            while (receiver.drain(1 << 20, discard).value_or(0) != 0) {}
+            return sent;
+        }));
+
+    // poll_one hands out a view into the ring, so its GB/s is the rate payload
+    // becomes readable, not a copy rate
+    auto handle = [&sink](const void* data, size_t) {
+        sink += *static_cast<const uint8_t*>(data);
+    };
+    samples.push_back(measure("receiver_poll_one", message_size, ring_size, min_ns,
+        [&](uint64_t& timed_ns) {
+            const size_t sent = fill();
+            const uint64_t start = now_ns();
+            for (size_t i = 0; i < sent; ++i) {
+                [[maybe_unused]] auto result = receiver.poll_one(handle);
+            }
+            timed_ns += now_ns() - start;
+            return sent;
+        }));
+}
+
+void write_json(const std::string& path, const std::vector<Sample>& samples) {
+    std::ofstream out(path);
+    out << std::setprecision(6);
+    out << "{\n";
+    out << "  \"library_version\": \"" << SWIFTCHANNEL_VERSION_MAJOR << "."
+        << SWIFTCHANNEL_VERSION_MINOR << "." << SWIFTCHANNEL_VERSION_PATCH << "\",\n";
+    out << "  \"protocol_version\": \"" << PROTOCOL_VERSION.major << "."
+        << PROTOCOL_VERSION.minor << "." << PROTOCOL_VERSION.patch << "\",\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < samples.size(); ++i) {
+        const Sample& sample = samples[i];
+        out << "    {\"benchmark\": \"" << sample.benchmark << "\""
+            << ", \"message_size\": " << sample.message_size
+            << ", \"ring_size\": " << sample.ring_size
+            << ", \"ops\": " << sample.ops
+            << ", \"ns_per_op\": " << sample.ns_per_op
+            << ", \"msgs_per_sec\": " << sample.msgs_per_sec()
+            << ", \"gb_per_sec\": " << sample.gb_per_sec() << "}"
+            << (i + 1 < samples.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string json_path;
+    uint64_t min_ms = 200;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (arg == "--min-ms" && i + 1 < argc) {
+            min_ms = std::strtoull(argv[++i], nullptr, 10);
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--json FILE] [--min-ms N]\n";
+            return 2;
+        }
+    }
+
+    std::vector<Sample> samples;
+    uint64_t sink = 0;
+    for (size_t ring_size : RING_SIZES) {
+        for (size_t message_size : MESSAGE_SIZES) {
+            // At least four records per ring, so a stretch is never a single write
+            const size_t per_ring = ring_size / (message_size + sizeof(MessageHeader));
+            if (per_ring < 4) {
+                continue;
+            }
+            const size_t stretch = std::min(STRETCH, per_ring - 1);
+            bench_ring(message_size, ring_size, stretch, min_ms * 1000000, samples, sink);
+            bench_channel(message_size, ring_size, stretch, min_ms * 1000000, samples, sink);
+        }
+    }
+
+    std::cout << std::left << std::setw(20) << "benchmark" << std::right
+              << std::setw(8) << "msg B" << std::setw(11) << "ring B"
+              << std::setw(11) << "ns/op" << std::setw(14) << "msgs/s"
+              << std::setw(9) << "GB/s" << "\n";
+    std::cout << std::fixed;
+    for (const Sample& sample : samples) {
+        std::cout << std::left << std::setw(20) << sample.benchmark << std::right
+                  << std::setw(8) << sample.message_size << std::setw(11) << sample.ring_size
+                  << std::setprecision(2) << std::setw(11) << sample.ns_per_op
+                  << std::setprecision(0) << std::setw(14) << sample.msgs_per_sec()
+                  << std::setprecision(2) << std::setw(9) << sample.gb_per_sec() << "\n";
+    }
+    std::cout << "(sink " << sink << ")\n";
+
+    if (!json_path.empty()) {
+        write_json(json_path, samples);
+        std::cout << "Wrote " << json_path << "\n";
+    }
+    return 0;
+}
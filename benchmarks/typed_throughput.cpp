@@ -0,0 +1,144 @@
+#include <swiftchannel/sender/ring_buffer.hpp>
+#include <swiftchannel/sender/typed_ring_buffer.hpp>
+#include <swiftchannel/common/types.hpp>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+using namespace swiftchannel;
+
+// Typed slot ring vs. byte ring throughput
+// Moves the same fixed-size structs through RingBuffer (32-byte header per
+// record, 8-byte aligned payload) and TypedRingBuffer<T> (bare slots), one
+// producer thread and one consumer thread, with the same ring byte size.
+
+namespace {
+
+template<size_t Size>
+struct Payload {
+    uint64_t words[Size / sizeof(uint64_t)];
+};
+
+// Channel-like layout: header followed by the ring
+struct Memory {
+    explicit Memory(size_t ring_size)
+        : header_size(align_up(sizeof(SharedMemoryHeader), CACHE_LINE_SIZE))
+        , base(::operator new(header_size + ring_size, std::align_val_t{CACHE_LINE_SIZE}))
+    {
+        std::memset(base, 0, header_size + ring_size);
+    }
+
+    ~Memory() {
+        ::operator delete(base, std::align_val_t{CACHE_LINE_SIZE});
+    }
+
+    SharedMemoryHeader* header() const { return static_cast<SharedMemoryHeader*>(base); }
+    void* ring() const { return static_cast<uint8_t*>(base) + header_size; }
+
+    size_t header_size;
+    void* base;
+};
+
+template<typename Write, typename Read>
+double run(uint64_t count, Write&& write, Read&& read) {
+    std::atomic<bool> go{false};
+
+    std::thread consumer([&]() {
+        while (!go.load(std::memory_order_acquire)) {}
+        for (uint64_t received = 0; received < count;) {
+            if (read()) {
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    go.store(true, std::memory_order_release);
+    const auto start = std::chrono::steady_clock::now();
+
+    for (uint64_t sent = 0; sent < count;) {
+        if (write(sent)) {
+            ++sent;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    consumer.join();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+template<size_t Size>
+void compare(uint64_t count) {
+    using T = Payload<Size>;
+    constexpr size_t capacity = 16384;
+    using Typed = TypedRingBuffer<T, capacity>;
+    constexpr size_t ring_size = Typed::ring_size;
+
+    double byte_seconds = 0;
+    {
+        Memory memory(ring_size);
+        RingBuffer producer(memory.ring(), ring_size);
+        RingBuffer consumer(memory.ring(), ring_size);
+        T value{};
+        T out{};
+        byte_seconds = run(count,
+            [&](uint64_t i) {
+                value.words[0] = i;
+                return producer.try_write(&value, sizeof(T), memory.header());
+            },
+            [&]() {
+                size_t size = sizeof(T);
+                return consumer.try_read(&out, size, memory.header());
+            });
+    }
+
+    double typed_seconds = 0;
+    {
+        Memory memory(ring_size);
+        Typed producer(memory.ring());
+        Typed consumer(memory.ring());
+        T value{};
+        T out{};
+        typed_seconds = run(count,
+            [&](uint64_t i) {
+                value.words[0] = i;
+                return producer.try_write(value, memory.header());
+            },
+            [&]() {
+                return consumer.try_read(out, memory.header());
+            });
+    }
+
+    const double byte_rate = static_cast<double>(count) / byte_seconds / 1e6;
+    const double typed_rate = static_cast<double>(count) / typed_seconds / 1e6;
+
+    std::cout << std::setw(8) << Size
+              << std::setw(14) << std::fixed << std::setprecision(2) << byte_rate
+              << std::setw(14) << typed_rate
+              << std::setw(10) << std::setprecision(2) << typed_rate / byte_rate << "x\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // Optional argument: messages per run
+    const uint64_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 20000000;
+
+    std::cout << "SwiftChannel typed vs. byte ring (" << count << " messages)\n";
+    std::cout << std::setw(8) << "size" << std::setw(14) << "byte Mmsg/s"
+              << std::setw(14) << "typed Mmsg/s" << std::setw(11) << "speedup" << "\n";
+
+    compare<16>(count);
+    compare<32>(count);
+    compare<48>(count);
+    compare<64>(count);
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+#include <swiftchannel/sender/ring_buffer.hpp>
+#include <swiftchannel/common/wait.hpp>
+#include <swiftchannel/common/types.hpp>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <algorithm>
+#include <sys/resource.h>
+
+using namespace swiftchannel;
+
+// Wait strategy comparison
+// A producer sends timestamped messages at a fixed interval; the consumer
+// waits for each one with the strategy under test. Reports the wake-up
+// latency (send to receive) and the CPU time the consumer burned, which is
+// the trade-off the strategies make. The channel has BlockingWait set, so
+// Park and Adaptive really sleep.
+
+namespace {
+
+struct Result {
+    double mean_us;
+    double p99_us;
+    double cpu_percent;
+};
+
+// CPU time consumed by the calling thread
+double thread_cpu_seconds() {
+    rusage usage{};
+    ::getrusage(RUSAGE_THREAD, &usage);
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1e-6;
+}
+
+Result run(WaitStrategy strategy, uint64_t interval_us, uint64_t message_count) {
+    constexpr size_t ring_size = 64 * 1024;
+    const size_t header_size = align_up(sizeof(SharedMemoryHeader), CACHE_LINE_SIZE);
+    void* memory = ::operator new(header_size + ring_size, std::align_val_t{CACHE_LINE_SIZE});
+    std::memset(memory, 0, header_size + ring_size);
+
+    auto* header = static_cast<SharedMemoryHeader*>(memory);
+    void* ring_memory = static_cast<uint8_t*>(memory) + header_size;
+    const auto flags = static_cast<uint64_t>(ChannelFlags::BlockingWait);
+
+    std::vector<uint64_t> latencies;
+    latencies.reserve(message_count);
+    double cpu_seconds = 0;
+    double wall_seconds = 0;
+
+    std::thread consumer([&]() {
+        RingBuffer rb(ring_memory, ring_size, flags);
+        Waiter waiter(strategy);
+        const double cpu_start = thread_cpu_seconds();
+        const auto wall_start = std::chrono::steady_clock::now();
+
+        auto ready = [&] { return rb.readable(header); };
+        auto park = [&](uint64_t ns) { rb.wait_for_data(header, ns, [] { return false; }); };
+
+        for (uint64_t received = 0; received < message_count;) {
+            uint64_t sent_at = 0;
+            size_t size = sizeof(sent_at);
+            if (rb.try_read(&sent_at, size, header)) {
+                latencies.push_back(steady_now_ns() - sent_at);
+                waiter.progress();
+                ++received;
+            } else {
+                waiter.idle(0, &header->write_index, ready, park);
+            }
+        }
+
+        cpu_seconds = thread_cpu_seconds() - cpu_start;
+        wall_seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - wall_start).count();
+    });
+
+    RingBuffer rb(ring_memory, ring_size, flags);
+    for (uint64_t i = 0; i < message_count; ++i) {
+        std::this_thread::sleep_for(std::chrono::microseconds(interval_us));
+        const uint64_t now = steady_now_ns();
+        while (!rb.try_write(&now, sizeof(now), header)) {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+
+    ::operator delete(memory, std::align_val_t{CACHE_LINE_SIZE});
+
+    std::sort(latencies.begin(), latencies.end());
+    double total = 0;
+    for (uint64_t latency : latencies) {
+        total += static_cast<double>(latency);
+    }
+
+    return Result{
+        total / static_cast<double>(latencies.size()) / 1000.0,
+        static_cast<double>(latencies[latencies.size() * 99 / 100]) / 1000.0,
+        100.0 * cpu_seconds / wall_seconds,
+    };
+}
+
+const char* name(WaitStrategy strategy) {
+    switch (strategy) {
+        case WaitStrategy::BusySpin: return "busy-spin";
+        case WaitStrategy::Backoff:  return "backoff";
+        case WaitStrategy::Yield:    return "yield";
+        case WaitStrategy::Sleep:    return "sleep";
+        case WaitStrategy::Park:     return "park";
+        case WaitStrategy::UmWait:   return cpu_has_waitpkg() ? "umwait" : "umwait*";
+        case WaitStrategy::Adaptive: return "adaptive";
+    }
+    return "?";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    // Optional argument: messages per measurement
+    const uint64_t message_count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 2000;
+
+    std::cout << "SwiftChannel wait strategies (latency in us, consumer CPU in %)\n";
+    std::cout << "(* = no WAITPKG on this CPU, runs as busy-spin)\n";
+
+    for (uint64_t interval_us : {10, 100, 1000}) {
+        std::cout << "\nOne message every " << interval_us << " us\n";
+        std::cout << std::setw(12) << "strategy" << std::setw(12) << "mean"
+                  << std::setw(12) << "p99" << std::setw(12) << "cpu" << "\n";
+
+        for (WaitStrategy strategy : {WaitStrategy::BusySpin, WaitStrategy::Backoff,
+                                      WaitStrategy::Yield, WaitStrategy::Sleep,
+                                      WaitStrategy::Park, WaitStrategy::UmWait,
+                                      WaitStrategy::Adaptive}) {
+            const Result result = run(strategy, interval_us, message_count);
+            std::cout << std::setw(12) << name(strategy) << std::fixed << std::setprecision(1)
+                      << std::setw(12) << result.mean_us << std::setw(12) << result.p99_us
+                      << std::setw(11) << result.cpu_percent << "%\n";
+        }
+    }
+
+    return 0;
+}
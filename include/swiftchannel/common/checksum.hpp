@@ -0,0 +1,191 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <nmmintrin.h>
+#define SWIFTCHANNEL_CRC32C_X86 1
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define SWIFTCHANNEL_CRC32C_ARM 1
+#endif
+
+namespace swiftchannel {
+
+// CRC32C (Castagnoli) payload checksums
+// Uses the SSE4.2 crc32 instruction when the CPU has it (checked once at
+// run time unless the build already targets SSE4.2), the ARMv8 CRC
+// extension when compiled in, and a slicing-by-8 table otherwise. All
+// variants produce the same value. copy_crc32c computes the checksum while
+// copying, so the payload is only read once.
+
+namespace detail {
+
+constexpr uint32_t CRC32C_POLY = 0x82F63B78;  // Reflected Castagnoli polynomial
+
+constexpr std::array<std::array<uint32_t, 256>, 8> make_crc32c_tables() noexcept {
+    std::array<std::array<uint32_t, 256>, 8> tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ ((crc & 1) ? CRC32C_POLY : 0);
+        }
+        tables[0][i] = crc;
+    }
+    for (size_t t = 1; t < 8; ++t) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            tables[t][i] = (tables[t - 1][i] >> 8) ^ tables[0][tables[t - 1][i] & 0xFF];
+        }
+    }
+    return tables;
+}
+
+inline constexpr auto CRC32C_TABLES = make_crc32c_tables();
+
+// Bytes of a loaded word in memory order, first byte lowest
+// (a no-op on little-endian hosts)
+constexpr uint64_t little_endian(uint64_t word) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        return word;
+    } else {
+        uint64_t swapped = 0;
+        for (int i = 0; i < 8; ++i, word >>= 8) {
+            swapped = (swapped << 8) | (word & 0xFF);
+        }
+        return swapped;
+    }
+}
+
+// Slicing-by-8 step over one little-endian 64-bit word
+inline uint32_t crc32c_word_portable(uint32_t crc, uint64_t word) noexcept {
+    const auto& t = CRC32C_TABLES;
+    word ^= crc;
+    return t[7][word & 0xFF] ^ t[6][(word >> 8) & 0xFF] ^
+           t[5][(word >> 16) & 0xFF] ^ t[4][(word >> 24) & 0xFF] ^
+           t[3][(word >> 32) & 0xFF] ^ t[2][(word >> 40) & 0xFF] ^
+           t[1][(word >> 48) & 0xFF] ^ t[0][word >> 56];
+}
+
+inline uint32_t crc32c_byte_portable(uint32_t crc, uint8_t byte) noexcept {
+    return (crc >> 8) ^ CRC32C_TABLES[0][(crc ^ byte) & 0xFF];
+}
+
+// Each variant below runs the same loop: 8 bytes at a time, then the tail
+// byte by byte. With Copy, every word is stored to dst right after it is
+// loaded. The loops are spelled out per variant so that the instruction
+// steps inline into code compiled for the right target.
+
+template<bool Copy>
+inline uint32_t crc32c_portable(uint32_t crc, uint8_t* dst, const uint8_t* src, size_t size) noexcept {
+    for (; size >= 8; size -= 8, src += 8) {
+        uint64_t word;
+        std::memcpy(&word, src, 8);
+        if constexpr (Copy) {
+            std::memcpy(dst, &word, 8);
+            dst += 8;
+        }
+        crc = crc32c_word_portable(crc, little_endian(word));
+    }
+    for (; size > 0; --size, ++src) {
+        if constexpr (Copy) {
+            *dst++ = *src;
+        }
+        crc = crc32c_byte_portable(crc, *src);
+    }
+    return crc;
+}
+
+#if defined(SWIFTCHANNEL_CRC32C_X86)
+
+template<bool Copy>
+__attribute__((target("sse4.2")))
+inline uint32_t crc32c_sse42(uint32_t crc, uint8_t* dst, const uint8_t* src, size_t size) noexcept {
+    uint64_t crc64 = crc;
+    for (; size >= 8; size -= 8, src += 8) {
+        uint64_t word;
+        std::memcpy(&word, src, 8);
+        if constexpr (Copy) {
+            std::memcpy(dst, &word, 8);
+            dst += 8;
+        }
+        crc64 = _mm_crc32_u64(crc64, word);
+    }
+    crc = static_cast<uint32_t>(crc64);
+    for (; size > 0; --size, ++src) {
+        if constexpr (Copy) {
+            *dst++ = *src;
+        }
+        crc = _mm_crc32_u8(crc, *src);
+    }
+    return crc;
+}
+
+inline bool cpu_has_sse42() noexcept {
+#if defined(__SSE4_2__)
+    return true;
+#else
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("sse4.2") != 0;
+    }();
+    return supported;
+#endif
+}
+
+#elif defined(SWIFTCHANNEL_CRC32C_ARM)
+
+template<bool Copy>
+inline uint32_t crc32c_arm(uint32_t crc, uint8_t* dst, const uint8_t* src, size_t size) noexcept {
+    for (; size >= 8; size -= 8, src += 8) {
+        uint64_t word;
+        std::memcpy(&word, src, 8);
+        if constexpr (Copy) {
+            std::memcpy(dst, &word, 8);
+            dst += 8;
+        }
+        crc = __crc32cd(crc, little_endian(word));  // Also consumes the low byte first
+    }
+    for (; size > 0; --size, ++src) {
+        if constexpr (Copy) {
+            *dst++ = *src;
+        }
+        crc = __crc32cb(crc, *src);
+    }
+    return crc;
+}
+
+#endif
+
+template<bool Copy>
+inline uint32_t crc32c_dispatch(uint32_t crc, uint8_t* dst, const uint8_t* src, size_t size) noexcept {
+    crc = ~crc;
+#if defined(SWIFTCHANNEL_CRC32C_X86)
+    crc = cpu_has_sse42() ? crc32c_sse42<Copy>(crc, dst, src, size)
+                          : crc32c_portable<Copy>(crc, dst, src, size);
+#elif defined(SWIFTCHANNEL_CRC32C_ARM)
+    crc = crc32c_arm<Copy>(crc, dst, src, size);
+#else
+    crc = crc32c_portable<Copy>(crc, dst, src, size);
+#endif
+    return ~crc;
+}
+
+} // namespace detail
+
+// CRC32C of size bytes at data; pass a previous result as crc to continue it
+[[nodiscard]] inline uint32_t crc32c(const void* data, size_t size, uint32_t crc = 0) noexcept {
+    return detail::crc32c_dispatch<false>(crc, nullptr, static_cast<const uint8_t*>(data), size);
+}
+
+// Copy size bytes from src to dst and return the CRC32C of the copied bytes
+[[nodiscard]] inline uint32_t copy_crc32c(void* dst, const void* src, size_t size,
+                                          uint32_t crc = 0) noexcept {
+    return detail::crc32c_dispatch<true>(crc, static_cast<uint8_t*>(dst),
+                                         static_cast<const uint8_t*>(src), size);
+}
+
+} // namespace swiftchannel
@@ -0,0 +1,334 @@
+#pragma once
+
+#include "futex.hpp"
+#include "wait.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace swiftchannel {
+
+// Coroutine support: Task<T> and a single-threaded Executor
+// Sender::async_send, Receiver::next and Receiver::next_batch return
+// awaitables. Awaited inside a task that an Executor runs, they suspend the
+// task instead of the thread, so one thread can drive thousands of flows.
+// When every task is waiting the executor parks on the channels' futexes
+// (ChannelConfig::blocking_wait); channels without them are re-checked
+// every poll interval. Awaited anywhere else, they block the thread.
+
+class Executor;
+
+// What a suspended coroutine waits for (see Executor::suspend)
+struct Readiness {
+    bool (*poll)(void* context);     // True once the coroutine can resume
+    void* context;
+    std::atomic<uint32_t>* futex;    // Bumped and woken when poll may turn true
+                                     // (null: re-checked every poll interval)
+    std::atomic<uint32_t>* waiters;  // Counted while parked, so wakers know to wake
+};
+
+namespace detail {
+
+struct PromiseBase {
+    std::coroutine_handle<> continuation;  // Awaiting task, if any
+    Executor* executor = nullptr;          // Owner of a spawned task
+    size_t slot = 0;                       // Its index in the owner's live tasks
+
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept;
+        void await_resume() noexcept {}
+    };
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    void unhandled_exception() noexcept { std::terminate(); }
+};
+
+template<typename T>
+struct ValuePromise : PromiseBase {
+    std::optional<T> value;
+    void return_value(T result) { value.emplace(std::move(result)); }
+    T take() { return std::move(*value); }
+};
+
+template<>
+struct ValuePromise<void> : PromiseBase {
+    void return_void() noexcept {}
+    void take() noexcept {}
+};
+
+} // namespace detail
+
+// Lazily started coroutine returning T
+// Runs when awaited (resuming the awaiter when it finishes) or when handed
+// to Executor::spawn.
+template<typename T = void>
+class [[nodiscard]] Task {
+public:
+    struct promise_type : detail::ValuePromise<T> {
+        Task get_return_object() noexcept {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+    };
+
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    // Start the task and resume the awaiter with its result
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            Handle handle;
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+            T await_resume() { return handle.promise().take(); }
+        };
+        return Awaiter{handle_};
+    }
+
+    // Give up ownership of the coroutine (Executor::spawn)
+    Handle release() noexcept {
+        return std::exchange(handle_, {});
+    }
+
+private:
+    explicit Task(Handle handle) noexcept : handle_(handle) {}
+
+    Handle handle_;
+};
+
+// Runs spawned tasks on the thread that calls run()
+// Not thread-safe, except for stop().
+class Executor {
+public:
+    explicit Executor(WaitStrategy strategy = WaitStrategy::Adaptive,
+                      uint64_t poll_interval_us = 50) noexcept
+        : waiter_(strategy, poll_interval_us * 1000)
+        , poll_interval_ns_(poll_interval_us * 1000)
+    {}
+
+    // Unfinished tasks are destroyed
+    ~Executor() {
+        for (const Live& live : live_) {
+            live.handle.destroy();
+        }
+    }
+
+    Executor(const Executor&) = delete;
+    Executor& operator=(const Executor&) = delete;
+
+    // Run task from the next call to run() on
+    void spawn(Task<void> task) {
+        auto handle = task.release();
+        handle.promise().executor = this;
+        handle.promise().slot = live_.size();
+        live_.push_back(Live{handle, &handle.promise()});
+        ready_.push_back(handle);
+    }
+
+    // Run tasks until all have finished, none can make progress, or stop()
+    // A stop() is consumed by the run() it ends; one made while no run() is
+    // going ends the next one right away.
+    void run() {
+        Executor* const outer = current_;
+        current_ = this;
+
+        while (!live_.empty() && !stopped_.exchange(false, std::memory_order_acquire)) {
+            while (!ready_.empty()) {
+                auto handle = ready_.front();
+                ready_.pop_front();
+                handle.resume();
+                reap();
+            }
+            if (waiting_.empty()) {
+                break;  // Everything left is finished or waits on nothing we know
+            }
+            if (poll_waiting()) {
+                waiter_.progress();
+            } else {
+                waiter_.idle(0, nullptr,
+                    [this] { return stopped_.load(std::memory_order_acquire) || poll_waiting(); },
+                    [this](uint64_t park_ns) { park(park_ns); });
+            }
+        }
+
+        current_ = outer;
+    }
+
+    // Make run() return soon (callable from any thread)
+    void stop() noexcept {
+        stopped_.store(true, std::memory_order_release);
+        stop_futex_.fetch_add(1, std::memory_order_release);
+        futex_wake_all(&stop_futex_);
+    }
+
+    // Spawned tasks that have not finished
+    [[nodiscard]] size_t pending() const noexcept {
+        return live_.size();
+    }
+
+    // Executor running on this thread (null outside run())
+    [[nodiscard]] static Executor* current() noexcept {
+        return current_;
+    }
+
+    // Resume handle on the next pass
+    void schedule(std::coroutine_handle<> handle) {
+        ready_.push_back(handle);
+    }
+
+    // Resume handle once readiness.poll() returns true
+    void suspend(std::coroutine_handle<> handle, const Readiness& readiness) {
+        waiting_.push_back(Waiting{handle, readiness});
+    }
+
+    // Called by a spawned task that has run to completion
+    void finished(detail::PromiseBase& promise) {
+        done_.push_back(&promise);
+    }
+
+private:
+    struct Live {
+        std::coroutine_handle<> handle;
+        detail::PromiseBase* promise;
+    };
+
+    struct Waiting {
+        std::coroutine_handle<> handle;
+        Readiness readiness;
+    };
+
+    // Move every wait that is over to ready_; true if any was
+    bool poll_waiting() {
+        const size_t before = ready_.size();
+        for (size_t i = 0; i < waiting_.size();) {
+            if (waiting_[i].readiness.poll(waiting_[i].readiness.context)) {
+                ready_.push_back(waiting_[i].handle);
+                waiting_[i] = waiting_.back();
+                waiting_.pop_back();
+            } else {
+                ++i;
+            }
+        }
+        return ready_.size() != before;
+    }
+
+    // Sleep until a futex some wait named is woken, or stop()
+    // Registers as a waiter on each, as RingBuffer::wait_for_data does for
+    // one; waits without a futex cap the sleep at the poll interval.
+    void park(uint64_t park_ns) {
+        parked_.clear();
+        counted_.clear();
+        parked_.push_back({&stop_futex_, stop_futex_.load(std::memory_order_acquire)});
+
+        bool watched_all = true;
+        for (const Waiting& waiting : waiting_) {
+            std::atomic<uint32_t>* futex = waiting.readiness.futex;
+            if (futex == nullptr) {
+                watched_all = false;
+                continue;
+            }
+            if (std::any_of(parked_.begin(), parked_.end(),
+                            [futex](const FutexWaitEntry& entry) { return entry.word == futex; })) {
+                continue;  // Another flow on the same channel
+            }
+            if (parked_.size() == FUTEX_WAIT_ANY_MAX) {
+                watched_all = false;
+                continue;
+            }
+            parked_.push_back({futex, futex->load(std::memory_order_acquire)});
+            if (waiting.readiness.waiters != nullptr) {
+                waiting.readiness.waiters->fetch_add(1, std::memory_order_relaxed);
+                counted_.push_back(waiting.readiness.waiters);
+            }
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);  // Pairs with the wakers
+
+        if (!watched_all && (park_ns == 0 || park_ns > poll_interval_ns_)) {
+            park_ns = poll_interval_ns_;
+        }
+        if (!stopped_.load(std::memory_order_acquire) && !poll_waiting()) {
+            futex_wait_any(parked_, park_ns);
+        }
+
+        for (auto* waiters : counted_) {
+            waiters->fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Destroy tasks that finished during the last resume
+    // Each leaves live_ by swap-and-pop at the slot its promise records.
+    void reap() {
+        for (detail::PromiseBase* promise : done_) {
+            const size_t slot = promise->slot;
+            const std::coroutine_handle<> handle = live_[slot].handle;
+            live_[slot] = live_.back();
+            live_[slot].promise->slot = slot;
+            live_.pop_back();
+            handle.destroy();
+        }
+        done_.clear();
+    }
+
+    static inline thread_local Executor* current_ = nullptr;
+
+    std::deque<std::coroutine_handle<>> ready_;
+    std::vector<Waiting> waiting_;
+    std::vector<Live> live_;  // Spawned, not yet finished
+    std::vector<detail::PromiseBase*> done_;
+    std::vector<FutexWaitEntry> parked_;                // Reused by park
+    std::vector<std::atomic<uint32_t>*> counted_;
+    Waiter waiter_;
+    uint64_t poll_interval_ns_;
+    std::atomic<bool> stopped_{false};
+    std::atomic<uint32_t> stop_futex_{0};
+};
+
+namespace detail {
+
+template<typename Promise>
+std::coroutine_handle<> PromiseBase::FinalAwaiter::await_suspend(
+    std::coroutine_handle<Promise> handle) noexcept {
+    PromiseBase& promise = handle.promise();
+    if (promise.continuation) {
+        return promise.continuation;
+    }
+    if (promise.executor != nullptr) {
+        promise.executor->finished(promise);
+    }
+    return std::noop_coroutine();
+}
+
+} // namespace detail
+
+} // namespace swiftchannel
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstdint>
+#include <span>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <climits>
+#include <ctime>
+#define SWIFTCHANNEL_HAS_FUTEX 1
+#if defined(SYS_futex_waitv) && defined(FUTEX_WAITV_MAX)
+#define SWIFTCHANNEL_HAS_FUTEX_WAITV 1
+#endif
+#endif
+
+namespace swiftchannel {
+
+// Futex wait/wake on a 32-bit word in shared memory
+// Process-shared (no FUTEX_PRIVATE_FLAG), so a sender can wake a receiver
+// in another process. Elsewhere, waiting degrades to a short sleep and
+// waking is a no-op; callers must re-check their condition either way.
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) &&
+              std::atomic<uint32_t>::is_always_lock_free,
+              "Futex words must be plain 32-bit integers");
+
+// Sleep while *word == expected, for at most timeout_ns (0 = no limit)
+// Returns early on a wake, a signal, or spuriously.
+inline void futex_wait(std::atomic<uint32_t>* word, uint32_t expected,
+                       uint64_t timeout_ns) noexcept {
+#if defined(SWIFTCHANNEL_HAS_FUTEX)
+    timespec timeout{};
+    timeout.tv_sec = static_cast<time_t>(timeout_ns / 1000000000);
+    timeout.tv_nsec = static_cast<long>(timeout_ns % 1000000000);
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected,
+              timeout_ns != 0 ? &timeout : nullptr, nullptr, 0);
+#else
+    if (word->load(std::memory_order_acquire) == expected) {
+        const uint64_t nap = (timeout_ns != 0 && timeout_ns < 50000) ? timeout_ns : 50000;
+        std::this_thread::sleep_for(std::chrono::nanoseconds(nap));
+    }
+#endif
+}
+
+// Wake every thread sleeping on word
+inline void futex_wake_all(std::atomic<uint32_t>* word) noexcept {
+#if defined(SWIFTCHANNEL_HAS_FUTEX)
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, INT_MAX,
+              nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+// Wake one thread sleeping on word
+inline void futex_wake_one(std::atomic<uint32_t>* word) noexcept {
+#if defined(SWIFTCHANNEL_HAS_FUTEX)
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, 1,
+              nullptr, nullptr, 0);
+#else
+    (void)word;
+#endif
+}
+
+// One word of a futex_wait_any call
+struct FutexWaitEntry {
+    std::atomic<uint32_t>* word;
+    uint32_t expected;
+};
+
+// Most words one futex_wait_any call can watch
+constexpr size_t FUTEX_WAIT_ANY_MAX = 128;
+
+// Sleep while every word equals its expected value, for at most
+// timeout_ns (0 = no limit); a wake on any one of them ends the wait
+// Uses futex_waitv (Linux 5.16+). Older kernels and other platforms nap
+// briefly instead, as futex_wait does without futexes.
+inline void futex_wait_any(std::span<const FutexWaitEntry> entries,
+                           uint64_t timeout_ns) noexcept {
+#if defined(SWIFTCHANNEL_HAS_FUTEX_WAITV)
+    static_assert(FUTEX_WAIT_ANY_MAX == FUTEX_WAITV_MAX);
+    futex_waitv waiters[FUTEX_WAIT_ANY_MAX] = {};
+    const size_t count = entries.size() < FUTEX_WAIT_ANY_MAX ? entries.size()
+                                                              : FUTEX_WAIT_ANY_MAX;
+    for (size_t i = 0; i < count; ++i) {
+        waiters[i].val = entries[i].expected;
+        waiters[i].uaddr = reinterpret_cast<uintptr_t>(entries[i].word);
+        waiters[i].flags = FUTEX_32;  // Process-shared, like futex_wait
+    }
+
+    // futex_waitv takes an absolute deadline
+    timespec deadline{};
+    if (timeout_ns != 0) {
+        ::clock_gettime(CLOCK_MONOTONIC, &deadline);
+        const uint64_t end = static_cast<uint64_t>(deadline.tv_sec) * 1000000000 +
+                             static_cast<uint64_t>(deadline.tv_nsec) + timeout_ns;
+        deadline.tv_sec = static_cast<time_t>(end / 1000000000);
+        deadline.tv_nsec = static_cast<long>(end % 1000000000);
+    }
+    if (::syscall(SYS_futex_waitv, waiters, static_cast<unsigned>(count), 0,
+                  timeout_ns != 0 ? &deadline : nullptr, CLOCK_MONOTONIC) == 0 ||
+        errno != ENOSYS) {
+        return;
+    }
+#endif
+    for (const FutexWaitEntry& entry : entries) {
+        if (entry.word->load(std::memory_order_acquire) != entry.expected) {
+            return;
+        }
+    }
+    const uint64_t nap = (timeout_ns != 0 && timeout_ns < 50000) ? timeout_ns : 50000;
+    std::this_thread::sleep_for(std::chrono::nanoseconds(nap));
+}
+
+} // namespace swiftchannel
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define SWIFTCHANNEL_HAS_NUMA 1
+#endif
+
+namespace swiftchannel {
+
+// NUMA placement of channel memory (Linux; no-ops elsewhere)
+// Policies are set with mbind on the shared mapping, which makes them the
+// policy of the shared memory object itself: pages land on the chosen
+// nodes whichever process touches them first. Raw system calls are used so
+// that libnuma is not a dependency.
+
+// Largest number of nodes the helpers below handle
+constexpr int MAX_NUMA_NODES = 1024;
+
+// NUMA node of the CPU the calling thread is running on (0 without NUMA)
+inline int current_numa_node() noexcept {
+#if defined(SWIFTCHANNEL_HAS_NUMA)
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+        return static_cast<int>(node);
+    }
+#endif
+    return 0;
+}
+
+// Apply a placement policy to [data, data + size), migrating pages that are
+// already there. Returns 0 or an errno value. NumaPolicy::ConsumerNode must
+// have been resolved to a Bind on the consumer's node by the caller.
+inline int apply_numa_policy(void* data, size_t size, NumaPolicy policy, int node) noexcept {
+#if defined(SWIFTCHANNEL_HAS_NUMA)
+    if (policy == NumaPolicy::Default || policy == NumaPolicy::ConsumerNode) {
+        return 0;
+    }
+
+    constexpr int bits = 8 * sizeof(unsigned long);
+    unsigned long mask[MAX_NUMA_NODES / bits] = {};
+    int mode = MPOL_BIND;
+
+    if (policy == NumaPolicy::Interleave) {
+        // Every node this process may allocate from
+        if (::syscall(SYS_get_mempolicy, nullptr, mask, MAX_NUMA_NODES, nullptr,
+                      MPOL_F_MEMS_ALLOWED) != 0) {
+            return errno == ENOSYS ? 0 : errno;
+        }
+        mode = MPOL_INTERLEAVE;
+    } else {
+        if (node < 0 || node >= MAX_NUMA_NODES) {
+            return EINVAL;
+        }
+        mask[node / bits] |= 1ul << (node % bits);
+    }
+
+    // Pages the peer has mapped too only move with CAP_SYS_NICE; without
+    // it, at least move our own (maxnode counts one past the last bit)
+    long result = ::syscall(SYS_mbind, data, size, mode, mask, MAX_NUMA_NODES + 1,
+                            MPOL_MF_MOVE_ALL);
+    if (result != 0 && errno == EPERM) {
+        result = ::syscall(SYS_mbind, data, size, mode, mask, MAX_NUMA_NODES + 1,
+                           MPOL_MF_MOVE);
+    }
+    if (result != 0) {
+        return errno == ENOSYS ? 0 : errno;  // Kernel without NUMA: one node
+    }
+#else
+    (void)data;
+    (void)size;
+    (void)policy;
+    (void)node;
+#endif
+    return 0;
+}
+
+// Where the pages of a mapping live
+struct PagePlacement {
+    std::vector<size_t> pages_per_node;  // Indexed by node
+    size_t not_present = 0;              // Never touched, so on no node yet
+};
+
+// Find the node of every page of [data, data + size)
+// Pages that exist but are not mapped by this process yet are mapped with a
+// read first, which allocates nothing. Counts are in base pages.
+inline PagePlacement page_placement(const void* data, size_t size) {
+    PagePlacement placement;
+#if defined(SWIFTCHANNEL_HAS_NUMA)
+    const auto page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t count = (size + page - 1) / page;
+    auto* bytes = static_cast<const volatile uint8_t*>(data);
+
+    std::vector<unsigned char> resident(count);
+    if (::mincore(const_cast<void*>(data), size, resident.data()) != 0) {
+        placement.not_present = count;
+        return placement;
+    }
+
+    constexpr size_t chunk = 1024;
+    std::vector<void*> pages;
+    std::vector<int> status(chunk);
+    for (size_t first = 0; first < count; first += chunk) {
+        pages.clear();
+        for (size_t i = first; i < count && i < first + chunk; ++i) {
+            if (resident[i] & 1) {
+                (void)bytes[i * page];
+            }
+            pages.push_back(const_cast<uint8_t*>(bytes + i * page));
+        }
+
+        // With no target nodes, move_pages only reports where pages are
+        if (::syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr,
+                      status.data(), 0) != 0) {
+            placement.not_present += pages.size();
+            continue;
+        }
+
+        for (size_t i = 0; i < pages.size(); ++i) {
+            if (status[i] < 0) {
+                ++placement.not_present;
+                continue;
+            }
+            const auto node = static_cast<size_t>(status[i]);
+            if (node >= placement.pages_per_node.size()) {
+                placement.pages_per_node.resize(node + 1);
+            }
+            ++placement.pages_per_node[node];
+        }
+    }
+#else
+    (void)data;
+    (void)size;
+#endif
+    return placement;
+}
+
+} // namespace swiftchannel
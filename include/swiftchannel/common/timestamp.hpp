@@ -0,0 +1,135 @@
+#pragma once
+
+#include "types.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#include <x86intrin.h>
+#define SWIFTCHANNEL_HAS_TSC 1
+#endif
+
+namespace swiftchannel {
+
+// Message timestamp sources
+// The producer stamps records with whatever its channel's source yields;
+// to_steady_ns() turns such a stamp back into steady_clock nanoseconds.
+
+// steady_clock in nanoseconds
+inline uint64_t steady_now_ns() noexcept {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Cheap monotonic clock with tick (not nanosecond) resolution
+// Same epoch as steady_clock where the platform allows it.
+inline uint64_t coarse_now_ns() noexcept {
+#if defined(CLOCK_MONOTONIC_COARSE)
+    timespec ts;
+    ::clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+#else
+    return steady_now_ns();
+#endif
+}
+
+// Current TSC value (0 where there is no TSC)
+inline uint64_t read_tsc() noexcept {
+#if defined(SWIFTCHANNEL_HAS_TSC)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// Check for an invariant TSC (constant rate, ticks through sleep states)
+// Without one, TSC stamps from different cores or times cannot be compared.
+inline bool tsc_is_invariant() noexcept {
+#if defined(SWIFTCHANNEL_HAS_TSC)
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007) {
+        return false;
+    }
+    __cpuid(0x80000007, eax, ebx, ecx, edx);
+    return (edx & (1u << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+// Measure the TSC rate against steady_clock over roughly duration_ns
+// Spins for the whole interval; done once when a TSC channel is created.
+inline TscCalibration calibrate_tsc(uint64_t duration_ns = 10000000) noexcept {
+    const uint64_t tsc_start = read_tsc();
+    const uint64_t ns_start = steady_now_ns();
+
+    uint64_t ns_end = ns_start;
+    while (ns_end - ns_start < duration_ns) {
+        ns_end = steady_now_ns();
+    }
+    const uint64_t tsc_end = read_tsc();
+
+    TscCalibration calibration{};
+    calibration.tsc_base = tsc_end;
+    calibration.ns_base = ns_end;
+    if (tsc_end > tsc_start) {
+        calibration.mult = ((ns_end - ns_start) << 32) / (tsc_end - tsc_start);
+    }
+    return calibration;
+}
+
+// Convert TSC ticks to steady_clock nanoseconds
+inline uint64_t tsc_to_ns(const TscCalibration& calibration, uint64_t ticks) noexcept {
+#if defined(SWIFTCHANNEL_HAS_TSC)
+    __extension__ typedef __int128 int128;  // Keeps the product exact for years of ticks
+
+    // Signed delta: stamps taken just before calibration finished are valid
+    const auto delta = static_cast<int128>(static_cast<int64_t>(ticks - calibration.tsc_base));
+    return calibration.ns_base + static_cast<uint64_t>((delta * calibration.mult) >> 32);
+#else
+    (void)ticks;
+    return calibration.ns_base;
+#endif
+}
+
+// Timestamp source a channel was created with
+inline TimestampSource timestamp_source(uint64_t flags) noexcept {
+    if (has_flag(flags, ChannelFlags::NoTimestamp)) {
+        return TimestampSource::None;
+    }
+    if (has_flag(flags, ChannelFlags::TscTimestamp)) {
+        return TimestampSource::Tsc;
+    }
+    if (has_flag(flags, ChannelFlags::CoarseTimestamp)) {
+        return TimestampSource::Coarse;
+    }
+    return TimestampSource::SteadyClock;
+}
+
+// Take a timestamp from the given source
+inline uint64_t take_timestamp(TimestampSource source) noexcept {
+    switch (source) {
+        case TimestampSource::Tsc:
+            return read_tsc();
+        case TimestampSource::Coarse:
+            return coarse_now_ns();
+        case TimestampSource::None:
+            return 0;
+        case TimestampSource::SteadyClock:
+            break;
+    }
+    return steady_now_ns();
+}
+
+// Convert a record timestamp to steady_clock nanoseconds (0 if not taken)
+inline uint64_t to_steady_ns(const SharedMemoryHeader* header, uint64_t stamp) noexcept {
+    if (timestamp_source(header->flags) == TimestampSource::Tsc) {
+        return tsc_to_ns(header->tsc, stamp);
+    }
+    return stamp;
+}
+
+} // namespace swiftchannel
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace swiftchannel {
+
+// Compile-time message type ids (carried in MessageHeader::type_id)
+// By default the id is a 32-bit FNV-1a hash of the type's name and layout,
+// so both sides agree as long as they are built with the same compiler. A
+// type can pin its id instead, which also holds across compilers:
+//     static constexpr uint32_t swiftchannel_type_id = 0x1001;
+// 0 means "untyped" and is never produced by the hash.
+
+namespace detail {
+
+constexpr uint32_t fnv1a(std::string_view text, uint32_t hash = 0x811C9DC5) noexcept {
+    for (char c : text) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 0x01000193;
+    }
+    return hash;
+}
+
+// Compiler's spelling of a signature that names T
+template<typename T>
+constexpr std::string_view type_signature() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+template<typename T>
+constexpr uint32_t hashed_type_id() noexcept {
+    uint32_t hash = fnv1a(type_signature<T>());
+    hash = (hash ^ static_cast<uint32_t>(sizeof(T))) * 0x01000193;
+    hash = (hash ^ static_cast<uint32_t>(alignof(T))) * 0x01000193;
+    return hash != 0 ? hash : 1;
+}
+
+template<typename T>
+concept HasPinnedTypeId = requires {
+    { T::swiftchannel_type_id } -> std::convertible_to<uint32_t>;
+};
+
+} // namespace detail
+
+template<typename T>
+constexpr uint32_t type_id_of() noexcept {
+    if constexpr (detail::HasPinnedTypeId<T>) {
+        static_assert(T::swiftchannel_type_id != 0, "Type id 0 is reserved for untyped messages");
+        return T::swiftchannel_type_id;
+    } else {
+        return detail::hashed_type_id<T>();
+    }
+}
+
+// Type id of T, usable as a constant expression
+template<typename T>
+inline constexpr uint32_t type_id_v = type_id_of<T>();
+
+} // namespace swiftchannel
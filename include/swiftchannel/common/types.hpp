@@ -6,6 +6,8 @@
 #include <chrono>
 #include <atomic>
 
+#include "alignment.hpp"
+
 namespace swiftchannel {
 
 // Forward declarations
@@ -20,44 +22,217 @@ using TimePoint = std::chrono::steady_clock::time_point;
 using Duration = std::chrono::nanoseconds;
 
 // Message header structure (appears before every message in the ring buffer)
+// This is the full framing; see RecordLayout for the compact one.
 struct MessageHeader {
     uint32_t magic;         // Magic number for validation
     uint32_t size;          // Payload size in bytes
     uint64_t sequence;      // Sequence number (monotonic)
-    uint64_t timestamp;     // Nanoseconds since epoch
+    uint64_t timestamp;     // Send time (see TimestampSource; 0 if disabled)
     uint32_t checksum;      // Optional checksum (0 if disabled)
-    uint32_t reserved;      // Reserved for future use
+    uint32_t type_id;       // Sender's type id (see type_id.hpp; 0 if untyped)
 
     static constexpr uint32_t MAGIC = 0x53574946;  // "SWIF"
+
+    // Padding record: only magic and size are present, and size is the
+    // total number of bytes to skip (at least 8)
+    static constexpr uint32_t PADDING = 0x53574950;  // "SWIP"
 };
 
 static_assert(sizeof(MessageHeader) == 32, "MessageHeader must be 32 bytes");
 static_assert(alignof(MessageHeader) <= 8, "MessageHeader alignment");
 
+// Where message timestamps come from (chosen per channel)
+enum class TimestampSource : uint8_t {
+    SteadyClock,    // std::chrono::steady_clock, in nanoseconds
+    Tsc,            // Raw invariant TSC ticks, converted with TscCalibration
+    Coarse,         // Low-resolution monotonic clock (cheap, millisecond-ish)
+    None,           // No timestamps (always 0)
+};
+
+// Which NUMA nodes a channel's pages are placed on (see numa.hpp)
+enum class NumaPolicy : uint8_t {
+    Default,        // First touch (usually whoever initializes the channel)
+    Bind,           // ChannelConfig::numa_node
+    ConsumerNode,   // The node the receiver opens the channel from
+    Interleave,     // Spread over every allowed node
+};
+
+// How an idle loop waits (see Waiter in wait.hpp)
+enum class WaitStrategy : uint8_t {
+    BusySpin,       // Spin with a pause hint; lowest latency, burns a core
+    Backoff,        // Spin with exponentially longer pauses, then yield
+    Yield,          // std::this_thread::yield() between checks
+    Sleep,          // Sleep ChannelConfig::wait_sleep_us between checks
+    Park,           // Futex (ChannelFlags::BlockingWait channels; else yields)
+    UmWait,         // UMONITOR/UMWAIT doze on WAITPKG CPUs; else BusySpin
+    Adaptive,       // Spin for about the usual wait, then park
+};
+
+// Maps TSC ticks onto steady_clock nanoseconds:
+// ns = ns_base + ((ticks - tsc_base) * mult) >> 32
+struct TscCalibration {
+    uint64_t tsc_base;
+    uint64_t ns_base;
+    uint64_t mult;
+};
+
+// Read position of one broadcast consumer, alone on its cache line
+struct alignas(CACHE_LINE_SIZE) ConsumerCursor {
+    std::atomic<uint64_t> position;  // Next byte this consumer will read
+    std::atomic<uint32_t> state;     // FREE or ACTIVE
+    std::atomic<uint32_t> pid;       // Owning process ID (0 while being claimed)
+
+    static constexpr uint32_t FREE = 0;
+    static constexpr uint32_t ACTIVE = 1;
+};
+
+static_assert(sizeof(ConsumerCursor) == CACHE_LINE_SIZE, "ConsumerCursor must be one cache line");
+
+// Maximum number of receivers attached to one broadcast channel
+constexpr size_t MAX_BROADCAST_CONSUMERS = 16;
+
 // Shared memory layout header
-struct SharedMemoryHeader {
+// Fields are grouped by owner so that the producer and the consumer never
+// write to the same cache line: the first line is written once at setup,
+// write_index lives alone on the producer's line and read_index alone on
+// the consumer's line. The wait line is only written by a receiver about to
+// park and a sender waking one. Broadcast consumers each own one cursor line.
+struct alignas(CACHE_LINE_SIZE) SharedMemoryHeader {
+    // Setup line (written once, then read-only)
     uint32_t magic;                 // Magic number
     uint32_t version;               // Protocol version
     uint64_t ring_buffer_size;      // Size of ring buffer in bytes
-    std::atomic<uint64_t> write_index;  // Write position (atomic)
-    std::atomic<uint64_t> read_index;   // Read position (atomic)
     uint32_t sender_pid;            // Sender process ID
     uint32_t receiver_pid;          // Receiver process ID
     uint64_t flags;                 // Configuration flags
-    uint64_t reserved[10];          // Reserved for future use (80 bytes)
+    uint32_t slot_size;             // sizeof(T) of a typed channel (0 = variable-size records)
+    TscCalibration tsc;             // Set by the creator of a ChannelFlags::TscTimestamp channel
+
+    // Producer line
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> write_index;  // Write position (atomic)
+    std::atomic<uint64_t> oldest_index;  // First intact record (ChannelFlags::Overwrite only)
+
+    // Consumer line
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> read_index;   // Read position (atomic)
+
+    // Wait line (ChannelFlags::BlockingWait and ChannelFlags::NotifyFd only)
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> data_futex;  // Bumped to wake receivers
+    std::atomic<uint32_t> data_waiters;  // Receivers parked (or about to park)
+    std::atomic<uint32_t> notify_armed;       // Receiver wants its eventfd signalled
+    std::atomic<uint32_t> notify_generation;  // Bumped when a receiver offers an eventfd
+    std::atomic<uint32_t> space_futex;    // Bumped to wake senders waiting for space
+    std::atomic<uint32_t> space_waiters;  // Senders parked (or about to park)
+
+    // Broadcast consumer cursors (ChannelFlags::Broadcast only)
+    ConsumerCursor cursors[MAX_BROADCAST_CONSUMERS];
 
     static constexpr uint32_t MAGIC = 0x53574946;  // "SWIF"
+    static constexpr uint32_t INITIALIZING = 0x53574930;  // "SWI0": claimed, not published yet
 };
 
-static_assert(sizeof(SharedMemoryHeader) == 128, "SharedMemoryHeader must be 128 bytes");
+static_assert(sizeof(SharedMemoryHeader) == (4 + MAX_BROADCAST_CONSUMERS) * CACHE_LINE_SIZE,
+              "SharedMemoryHeader must be a whole number of cache lines");
 
 // Configuration flags
 enum class ChannelFlags : uint64_t {
     None            = 0,
     NoChecksum      = 1 << 0,   // Disable checksum validation
-    Overwrite       = 1 << 1,   // Overwrite old messages if buffer full
+    Overwrite       = 1 << 1,   // Overwrite old messages if buffer full (lossy)
     SingleProducer  = 1 << 2,   // Only one sender (enables optimizations)
     SingleConsumer  = 1 << 3,   // Only one receiver (enables optimizations)
+    MultiProducer   = 1 << 4,   // Several senders may write concurrently (MPSC)
+    Broadcast       = 1 << 5,   // Every receiver sees every message (SPMC)
+    Checksum        = 1 << 6,   // Payloads carry a CRC32C, verified on read
+    TscTimestamp    = 1 << 7,   // Timestamps are TSC ticks (see SharedMemoryHeader::tsc)
+    CoarseTimestamp = 1 << 8,   // Timestamps come from a coarse monotonic clock
+    NoTimestamp     = 1 << 9,   // Timestamps are not taken
+    CompactFraming  = 1 << 10,  // Record headers carry only the fields in use
+    BlockingWait    = 1 << 11,  // Idle receivers park on a futex; senders wake them
+    NotifyFd        = 1 << 12,  // Senders signal the receiver's eventfd (see notify.hpp)
+    TypeIds         = 1 << 13,  // Compact records carry a type id (full ones always do)
+};
+
+constexpr bool has_flag(uint64_t flags, ChannelFlags flag) noexcept {
+    return (flags & static_cast<uint64_t>(flag)) != 0;
+}
+
+// Every flag this protocol version understands
+// A channel carrying any other bit was created by a newer peer whose
+// records this side could misread, so it is refused on open.
+constexpr uint64_t KNOWN_CHANNEL_FLAGS = (static_cast<uint64_t>(ChannelFlags::TypeIds) << 1) - 1;
+
+// Where the fields of a message record live, fixed when a channel is opened
+// Every record starts with magic and size, followed by the optional words
+// in fields, 8 bytes each: sequence (overwrite mode needs it to detect
+// laps), timestamp, then checksum and type id sharing a word. Full framing
+// carries all of them and is exactly MessageHeader; ChannelFlags::CompactFraming
+// keeps only the ones the channel uses. An offset of 0 means the field is
+// absent.
+struct RecordLayout {
+    // Optional words (bits of fields)
+    static constexpr uint32_t SEQUENCE = 1 << 0;
+    static constexpr uint32_t TIMESTAMP = 1 << 1;
+    static constexpr uint32_t TAGS = 1 << 2;  // Checksum and type id
+    static constexpr uint32_t ALL_FIELDS = SEQUENCE | TIMESTAMP | TAGS;
+
+    uint32_t header_size;
+    uint32_t sequence_offset;
+    uint32_t timestamp_offset;
+    uint32_t checksum_offset;
+    uint32_t type_id_offset;
+    uint32_t fields;
+
+    static constexpr RecordLayout for_fields(uint32_t fields) noexcept {
+        RecordLayout layout{8, 0, 0, 0, 0, fields & ALL_FIELDS};
+        if ((fields & SEQUENCE) != 0) {
+            layout.sequence_offset = layout.header_size;
+            layout.header_size += 8;
+        }
+        if ((fields & TIMESTAMP) != 0) {
+            layout.timestamp_offset = layout.header_size;
+            layout.header_size += 8;
+        }
+        if ((fields & TAGS) != 0) {
+            layout.checksum_offset = layout.header_size;  // 0 stored without checksums
+            layout.type_id_offset = layout.header_size + 4;
+            layout.header_size += 8;
+        }
+        return layout;
+    }
+
+    static constexpr RecordLayout for_flags(uint64_t flags) noexcept {
+        if (!has_flag(flags, ChannelFlags::CompactFraming)) {
+            return for_fields(ALL_FIELDS);
+        }
+
+        uint32_t fields = 0;
+        if (has_flag(flags, ChannelFlags::Overwrite)) {
+            fields |= SEQUENCE;
+        }
+        if (!has_flag(flags, ChannelFlags::NoTimestamp)) {
+            fields |= TIMESTAMP;
+        }
+        if (has_flag(flags, ChannelFlags::Checksum) || has_flag(flags, ChannelFlags::TypeIds)) {
+            fields |= TAGS;
+        }
+        return for_fields(fields);
+    }
+};
+
+static_assert(RecordLayout::for_fields(RecordLayout::ALL_FIELDS).header_size == sizeof(MessageHeader) &&
+              RecordLayout::for_fields(RecordLayout::ALL_FIELDS).sequence_offset == offsetof(MessageHeader, sequence) &&
+              RecordLayout::for_fields(RecordLayout::ALL_FIELDS).timestamp_offset == offsetof(MessageHeader, timestamp) &&
+              RecordLayout::for_fields(RecordLayout::ALL_FIELDS).checksum_offset == offsetof(MessageHeader, checksum) &&
+              RecordLayout::for_fields(RecordLayout::ALL_FIELDS).type_id_offset == offsetof(MessageHeader, type_id),
+              "Full framing is MessageHeader");
+static_assert(RecordLayout::for_flags(static_cast<uint64_t>(ChannelFlags::CompactFraming) |
+                                      static_cast<uint64_t>(ChannelFlags::NoTimestamp))
+                  .header_size == 8, "Bare compact records carry only magic and size");
+
+// Read-only view of one message payload inside the ring buffer
+struct MessageView {
+    const void* data;
+    size_t size;
 };
 
 // Callback type for message processing
@@ -18,9 +18,12 @@ struct Version {
         return !(*this == other);
     }
 
+    // Whether this side can use a channel created with version other
+    // Major versions must match. A newer minor may have added record or
+    // header features this side does not know, so only older (or equal)
+    // minors are accepted; patch can differ.
     constexpr bool is_compatible_with(const Version& other) const noexcept {
-        // Major version must match, minor/patch can differ
-        return major == other.major;
+        return major == other.major && other.minor <= minor;
     }
 
     std::string to_string() const {
@@ -56,6 +59,11 @@ constexpr Version LIBRARY_VERSION = {
 };
 
 // Protocol version (separate from library version)
-constexpr Version PROTOCOL_VERSION = {1, 0, 0};
+// 2.0 covers the shared memory header and record layouts of this release
+// (split index lines, broadcast cursors, overwrite and typed rings,
+// timestamps, compact framing, wait line, type ids). 1.x peers cannot read
+// them. Within 2.x, optional features are announced by ChannelFlags, and
+// peers refuse flags they do not know (KNOWN_CHANNEL_FLAGS).
+constexpr Version PROTOCOL_VERSION = {2, 0, 0};
 
 } // namespace swiftchannel
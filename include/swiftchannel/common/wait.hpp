@@ -0,0 +1,232 @@
+#pragma once
+
+#include "types.hpp"
+#include "timestamp.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#define SWIFTCHANNEL_HAS_WAITPKG 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace swiftchannel {
+
+// Idle-wait policies for consumer and producer loops (see WaitStrategy)
+// A Waiter runs one idle round per call and returns; the caller re-checks
+// its own condition and deadline in between. Parking itself (futex or
+// otherwise) is supplied by the caller, so the same Waiter serves receivers
+// waiting for data and senders waiting for space.
+
+// Spin-wait hint: lets the sibling hyperthread run and saves power
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(_M_ARM64) || defined(_M_ARM)
+    __yield();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+// Check for user-level monitor/wait (UMONITOR/UMWAIT/TPAUSE)
+inline bool cpu_has_waitpkg() noexcept {
+#if defined(SWIFTCHANNEL_HAS_WAITPKG)
+    static const bool supported = [] {
+        unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+        return __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0 && (ecx & (1u << 5)) != 0;
+    }();
+    return supported;
+#else
+    return false;
+#endif
+}
+
+#if defined(SWIFTCHANNEL_HAS_WAITPKG)
+
+// Arm a monitor on address's cache line (first half of umwait)
+__attribute__((target("waitpkg")))
+inline void umonitor(const void* address) noexcept {
+    _umonitor(const_cast<void*>(address));
+}
+
+// Doze in C0.2 until the monitored line is written or ticks TSC ticks pass
+// The OS caps the doze (IA32_UMWAIT_CONTROL, about 100 us by default).
+__attribute__((target("waitpkg")))
+inline void umwait(uint64_t ticks) noexcept {
+    _umwait(0, __rdtsc() + ticks);
+}
+
+// Doze in C0.2 for ticks TSC ticks (no monitor, e.g. when there is no
+// single word to watch)
+__attribute__((target("waitpkg")))
+inline void tpause(uint64_t ticks) noexcept {
+    _tpause(0, __rdtsc() + ticks);
+}
+
+#endif
+
+class Waiter {
+public:
+    explicit Waiter(WaitStrategy strategy = WaitStrategy::Adaptive,
+                    uint64_t sleep_ns = 50000) noexcept
+        : strategy_(strategy)
+        , sleep_ns_(sleep_ns)
+    {
+        if (strategy_ == WaitStrategy::UmWait && !cpu_has_waitpkg()) {
+            strategy_ = WaitStrategy::BusySpin;  // Same behaviour, minus the doze
+        }
+    }
+
+    // Wait one round for ready(), for at most timeout_ns (0 = no limit)
+    // monitor is the word a producer writes when ready() may change (used
+    // by UmWait). park(ns) blocks until woken or ns passes (0 = no limit);
+    // callers without a futex can pass one that yields. Returns ready().
+    template<typename Ready, typename Park>
+    bool idle(uint64_t timeout_ns, const void* monitor, Ready&& ready, Park&& park) {
+        if (ready()) {
+            return true;
+        }
+
+        // Start of this idle stretch, for the adaptive spin budget
+        if (strategy_ == WaitStrategy::Adaptive && idle_since_ == 0) {
+            idle_since_ = steady_now_ns();
+        }
+
+        switch (strategy_) {
+            case WaitStrategy::BusySpin:
+                return spin_for(limit(SPIN_ROUND_NS, timeout_ns), ready);
+
+            case WaitStrategy::Backoff:
+                // 1, 2, 4 ... 1024 pauses between checks, then yield
+                if (backoff_ < MAX_BACKOFF) {
+                    for (uint32_t i = 0; i < (1u << backoff_); ++i) {
+                        cpu_relax();
+                    }
+                    ++backoff_;
+                } else {
+                    std::this_thread::yield();
+                }
+                return ready();
+
+            case WaitStrategy::Yield:
+                std::this_thread::yield();
+                return ready();
+
+            case WaitStrategy::Sleep:
+                std::this_thread::sleep_for(
+                    std::chrono::nanoseconds(limit(sleep_ns_, timeout_ns)));
+                return ready();
+
+            case WaitStrategy::Park:
+                park(timeout_ns);
+                return ready();
+
+            case WaitStrategy::UmWait:
+#if defined(SWIFTCHANNEL_HAS_WAITPKG)
+                if (monitor == nullptr) {
+                    tpause(UMWAIT_TICKS);
+                    return ready();
+                }
+                // Arm first, then re-check, so a write in between ends the doze
+                umonitor(monitor);
+                if (!ready()) {
+                    umwait(UMWAIT_TICKS);
+                }
+#endif
+                (void)monitor;
+                return ready();
+
+            case WaitStrategy::Adaptive:
+                break;
+        }
+
+        // Adaptive: spin for as long as data has recently taken to show up,
+        // then park. A spin that is bound to fail costs no more than MIN.
+        const uint64_t spent = steady_now_ns() - idle_since_;
+        uint64_t spin = 0;
+        if (spent < spin_budget_ns_) {
+            spin = limit(spin_budget_ns_ - spent, timeout_ns);
+            if (spin_for(spin, ready)) {
+                return true;
+            }
+        }
+        if (timeout_ns != 0 && spin >= timeout_ns) {
+            return false;  // The whole round went to spinning
+        }
+        park(timeout_ns != 0 ? timeout_ns - spin : 0);
+        return ready();
+    }
+
+    // Report that the awaited condition came true (or work was done)
+    // Resets the backoff and feeds the adaptive strategy's estimate.
+    void progress() noexcept {
+        backoff_ = 0;
+        if (idle_since_ != 0) {
+            // Exponential average of how long idle stretches lasted; the
+            // budget covers twice that, within [MIN, MAX]
+            const uint64_t waited = steady_now_ns() - idle_since_;
+            average_wait_ns_ = average_wait_ns_ - average_wait_ns_ / 8 + waited / 8;
+            spin_budget_ns_ = std::clamp<uint64_t>(2 * average_wait_ns_,
+                                                   MIN_SPIN_NS, MAX_SPIN_NS);
+            if (average_wait_ns_ > MAX_SPIN_NS) {
+                spin_budget_ns_ = MIN_SPIN_NS;  // Spinning would not pay off
+            }
+            idle_since_ = 0;
+        }
+    }
+
+    [[nodiscard]] WaitStrategy strategy() const noexcept {
+        return strategy_;
+    }
+
+    // Current adaptive spin budget
+    [[nodiscard]] uint64_t spin_budget_ns() const noexcept {
+        return spin_budget_ns_;
+    }
+
+private:
+    static constexpr uint64_t SPIN_ROUND_NS = 50000;   // BusySpin re-checks the deadline
+    static constexpr uint64_t MIN_SPIN_NS = 1000;
+    static constexpr uint64_t MAX_SPIN_NS = 100000;
+    static constexpr uint32_t MAX_BACKOFF = 10;
+    static constexpr uint64_t UMWAIT_TICKS = 100000;
+
+    static uint64_t limit(uint64_t ns, uint64_t timeout_ns) noexcept {
+        return (timeout_ns != 0) ? std::min(ns, timeout_ns) : ns;
+    }
+
+    // Spin on ready() for about ns; the clock is read every 64 checks
+    template<typename Ready>
+    static bool spin_for(uint64_t ns, Ready& ready) {
+        const uint64_t start = steady_now_ns();
+        do {
+            for (int i = 0; i < 64; ++i) {
+                if (ready()) {
+                    return true;
+                }
+                cpu_relax();
+            }
+        } while (steady_now_ns() - start < ns);
+        return false;
+    }
+
+    WaitStrategy strategy_;
+    uint64_t sleep_ns_;
+    uint32_t backoff_ = 0;
+    uint64_t idle_since_ = 0;
+    uint64_t average_wait_ns_ = 0;
+    uint64_t spin_budget_ns_ = 20000;
+};
+
+} // namespace swiftchannel
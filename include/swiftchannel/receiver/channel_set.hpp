@@ -0,0 +1,119 @@
+#pragma once
+
+#include "swiftchannel/common/types.hpp"
+#include "swiftchannel/common/error.hpp"
+#include "swiftchannel/sender/config.hpp"
+#include "receiver.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace swiftchannel {
+
+// How a ChannelSet shares a thread between its channels
+enum class SchedulingPolicy : uint8_t {
+    RoundRobin,  // Every channel gets one burst per round; the first one rotates
+    Weighted,    // burst x weight per round, heaviest channel first
+};
+
+struct ChannelSetConfig {
+    SchedulingPolicy policy = SchedulingPolicy::RoundRobin;
+
+    // Messages one channel may deliver before the next gets its turn
+    size_t burst = 64;
+
+    // Threads started by start_async(); channels are split between them
+    // by weight, and each is served by exactly one
+    size_t threads = 1;
+
+    // How an idle set waits (see WaitStrategy)
+    WaitStrategy wait_strategy = WaitStrategy::Adaptive;
+    uint64_t wait_sleep_us = 50;  // For Sleep, and the polling period below
+};
+
+// Many channels served by one thread (or a few)
+// Each channel gets its own Receiver and handler. A round drains every
+// channel up to its budget, so a busy channel cannot starve a quiet one.
+// When a whole round comes up empty the set waits as a unit: channels
+// created with ChannelConfig::blocking_wait are parked on together in one
+// futex_waitv call, so a publish on any of them wakes the set. Other
+// channels cannot wake it and are re-checked every wait_sleep_us.
+class ChannelSet {
+public:
+    using MessageHandler = Receiver::MessageHandler;
+
+    explicit ChannelSet(const ChannelSetConfig& config = {});
+    ~ChannelSet();
+
+    // Non-copyable, non-movable (due to thread management)
+    ChannelSet(const ChannelSet&) = delete;
+    ChannelSet& operator=(const ChannelSet&) = delete;
+    ChannelSet(ChannelSet&&) = delete;
+    ChannelSet& operator=(ChannelSet&&) = delete;
+
+    // Attach a channel; handler receives its messages
+    // weight scales the channel's budget under SchedulingPolicy::Weighted.
+    // Returns the channel's index. Fails like Receiver would open it, or
+    // with InvalidOperation while the set is running.
+    Result<size_t> add(const std::string& channel_name, MessageHandler handler,
+                       const ChannelConfig& config = {}, uint32_t weight = 1);
+
+    // One scheduling round over every channel (non-blocking)
+    // Returns the number of messages handled.
+    Result<size_t> poll();
+
+    // Serve every channel from the current thread until stop()
+    Result<void> start();
+
+    // Serve the channels from ChannelSetConfig::threads background threads
+    Result<void> start_async();
+
+    // Stop serving (wakes a parked set)
+    void stop();
+
+    [[nodiscard]] bool is_running() const noexcept;
+
+    // Number of attached channels
+    [[nodiscard]] size_t size() const noexcept;
+
+    // Receiver of the channel at index, e.g. for its statistics
+    [[nodiscard]] Receiver& receiver(size_t index);
+
+    struct Stats {
+        uint64_t messages_received;  // Across every channel
+        uint64_t rounds;             // Scheduling rounds, empty ones included
+        uint64_t parks;              // Times the whole set went idle
+    };
+
+    [[nodiscard]] Stats get_stats() const noexcept;
+
+private:
+    struct Member;
+    struct Worker;
+
+    // One round over worker's channels; returns the messages handled
+    size_t serve_round(Worker& worker);
+
+    // Wait until one of worker's channels may have data, or stop()
+    void wait_idle(Worker& worker);
+
+    void serve(Worker& worker);
+
+    ChannelSetConfig config_;
+    std::vector<std::unique_ptr<Member>> members_;
+    std::vector<std::unique_ptr<Worker>> workers_;  // Built when serving starts
+    std::unique_ptr<Worker> poller_;                // poll()'s view of every channel
+    std::atomic<bool> running_{false};
+
+    // Bumped and woken by stop(); every parked worker also waits on it
+    std::atomic<uint32_t> stop_futex_{0};
+
+    std::atomic<uint64_t> rounds_{0};
+    std::atomic<uint64_t> parks_{0};
+};
+
+} // namespace swiftchannel
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "swiftchannel/common/types.hpp"
+#include "swiftchannel/common/error.hpp"
+#include "swiftchannel/common/type_id.hpp"
+#include "swiftchannel/sender/message.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace swiftchannel {
+
+// Routes messages to per-type handlers by the type id in their header
+// Senders tag every send<T> with type_id_v<T>; register a handler for each
+// T with on<T>() and pass the dispatcher to Receiver::dispatch. Lookup is
+// one probe into a flat open-addressed table of {id, thunk, handler}, and
+// the thunk calls the handler directly with a const T& into the ring (only
+// valid until the handler returns). Registration allocates; dispatch does
+// not.
+class Dispatcher {
+public:
+    // Receives messages whose type id has no handler, untyped messages
+    // (type id 0) and messages whose size does not match their type
+    using UnknownHandler = std::function<void(uint32_t type_id, const void* data, size_t size)>;
+
+    Dispatcher();
+    ~Dispatcher();
+
+    // Non-copyable, movable
+    Dispatcher(const Dispatcher&) = delete;
+    Dispatcher& operator=(const Dispatcher&) = delete;
+    Dispatcher(Dispatcher&&) noexcept;
+    Dispatcher& operator=(Dispatcher&&) noexcept;
+
+    // Handle every T with handler(const T&)
+    // Registering T again replaces its handler. Fails with InvalidOperation
+    // if a different type already has the same id (pin one of them; see
+    // type_id.hpp).
+    template<Sendable T, typename Handler>
+    Result<void> on(Handler&& handler) {
+        static_assert(alignof(T) <= 8, "Ring buffer payloads are 8-byte aligned");
+        static_assert(std::is_invocable_v<std::decay_t<Handler>&, const T&>,
+                      "Handler must be callable with const T&");
+
+        using Stored = std::decay_t<Handler>;
+        HandlerPtr stored(new Stored(std::forward<Handler>(handler)), [](void* target) {
+            delete static_cast<Stored*>(target);
+        });
+        return insert(type_id_v<T>, &type_tag<T>, &invoke<T, Stored>, std::move(stored));
+    }
+
+    // Handle whatever no typed handler takes (dropped if unset)
+    void on_unknown(UnknownHandler handler) {
+        unknown_ = std::move(handler);
+    }
+
+    // Route one message; returns false if it went to the unknown handler
+    inline bool dispatch(uint32_t type_id, const void* data, size_t size) {
+        for (size_t i = type_id & mask_;; i = (i + 1) & mask_) {
+            const Entry& entry = table_[i];
+            if (entry.type_id == type_id && type_id != 0) {
+                if (entry.thunk(entry.target, data, size)) {
+                    ++stats_.dispatched;
+                    return true;
+                }
+                break;  // Wrong size for its type
+            }
+            if (entry.type_id == 0) {
+                break;
+            }
+        }
+        route_unknown(type_id, data, size);
+        return false;
+    }
+
+    // Number of registered types
+    [[nodiscard]] size_t size() const noexcept {
+        return registrations_.size();
+    }
+
+    struct Stats {
+        uint64_t dispatched;  // Messages handed to a typed handler
+        uint64_t unknown;     // Messages routed to the unknown handler (or dropped)
+    };
+
+    [[nodiscard]] Stats get_stats() const noexcept {
+        return stats_;
+    }
+
+private:
+    // Calls a stored handler; false if size is not sizeof(T)
+    using Thunk = bool (*)(void* target, const void* data, size_t size);
+    using HandlerPtr = std::unique_ptr<void, void (*)(void*)>;
+
+    struct Entry {
+        uint32_t type_id;  // 0 = free slot
+        Thunk thunk;
+        void* target;
+    };
+
+    struct Registration {
+        uint32_t type_id;
+        const void* type_tag;  // Tells apart types whose ids collide
+        HandlerPtr handler;
+    };
+
+    template<typename T>
+    static constexpr char type_tag = 0;
+
+    template<typename T, typename Handler>
+    static bool invoke(void* target, const void* data, size_t size) {
+        if (size != sizeof(T)) {
+            return false;
+        }
+        (*static_cast<Handler*>(target))(*static_cast<const T*>(data));
+        return true;
+    }
+
+    Result<void> insert(uint32_t type_id, const void* tag, Thunk thunk,
+                        HandlerPtr handler);
+    void place(const Entry& entry) noexcept;
+    void reseed() noexcept;  // Empty table for a moved-from dispatcher
+    void route_unknown(uint32_t type_id, const void* data, size_t size);
+
+    std::vector<Entry> table_;  // Power-of-two size, at most half full
+    size_t mask_ = 0;
+    std::vector<Registration> registrations_;  // Owns what the entries point at
+    UnknownHandler unknown_;
+    Stats stats_{};
+};
+
+} // namespace swiftchannel
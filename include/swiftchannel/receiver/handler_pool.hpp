@@ -0,0 +1,140 @@
+#pragma once
+
+#include "swiftchannel/common/types.hpp"
+#include "swiftchannel/common/error.hpp"
+#include "swiftchannel/common/wait.hpp"
+#include "receiver.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace swiftchannel {
+
+struct HandlerPoolConfig {
+    // Handler threads (the receive thread is extra)
+    size_t threads = 4;
+
+    // Messages handed out but not yet finished; their ring space is held,
+    // so a sender sees the channel fill up once this many are pending
+    size_t max_in_flight = 1024;
+
+    // Ordering lanes; keys are hashed onto them, so two keys that share a
+    // lane are also handled in order (rounded up to a power of 2)
+    size_t lanes = 256;
+
+    // How the receive thread waits for data or a finished handler
+    WaitStrategy wait_strategy = WaitStrategy::Adaptive;
+    uint64_t wait_sleep_us = 50;  // For Sleep, and polling non-blocking channels
+};
+
+// Runs a Receiver's handler on a pool of threads
+// The receive thread peeks messages and hands each one, as a view into the
+// ring, to the lane its key hashes to. A lane is handled by one thread at
+// a time, in arrival order, so messages with equal keys are handled in
+// order while different keys run in parallel; idle threads steal lanes
+// from busy ones. Ring space is released only once every earlier message
+// has been handled, so nothing is copied out. Not for overwrite channels.
+class HandlerPool {
+public:
+    // Called from the pool's threads, concurrently for different lanes
+    using MessageHandler = Receiver::MessageHandler;
+
+    // Ordering key of a message
+    using KeyExtractor = std::function<uint64_t(const void* data, size_t size)>;
+
+    explicit HandlerPool(Receiver& receiver, const HandlerPoolConfig& config = {});
+    ~HandlerPool();
+
+    // Non-copyable, non-movable (due to thread management)
+    HandlerPool(const HandlerPool&) = delete;
+    HandlerPool& operator=(const HandlerPool&) = delete;
+    HandlerPool(HandlerPool&&) = delete;
+    HandlerPool& operator=(HandlerPool&&) = delete;
+
+    // Receive on the current thread until stop(), handling on the pool
+    // Without a key extractor the key is the message's type id (see
+    // Dispatcher), so untyped messages are all handled in order. Returns
+    // once every message handed out has been handled.
+    Result<void> start(MessageHandler handler, KeyExtractor key = {});
+
+    // Like start(), from a background thread
+    Result<void> start_async(MessageHandler handler, KeyExtractor key = {});
+
+    // Stop receiving; waits for start_async()'s thread to finish
+    void stop();
+
+    [[nodiscard]] bool is_running() const noexcept;
+
+    struct Stats {
+        uint64_t dispatched;  // Messages handed to the pool
+        uint64_t handled;     // Messages whose handler returned
+        uint64_t steals;      // Lanes taken from another thread's queue
+        uint64_t stalls;      // Times max_in_flight held up the receive thread
+    };
+
+    [[nodiscard]] Stats get_stats() const noexcept;
+
+private:
+    struct Slot;
+    struct Lane;
+    struct Queue;
+
+    // Checks shared by start() and start_async(); marks the receiver running
+    Result<void> enter(MessageHandler handler, KeyExtractor key);
+
+    // Receive until stopped, then wait for the pool to finish
+    void serve();
+
+    void hand_out(std::span<const uint8_t> payload, uint64_t end);
+    void worker_loop(size_t index);
+    bool take(size_t index, uint32_t& lane);
+    void run_lane(size_t index, uint32_t lane);
+    void schedule(uint32_t lane, size_t queue);
+
+    // Release the ring up to the oldest unfinished message; true if any
+    bool reclaim();
+
+    // Wait until the oldest message is handled or, if want_data, until
+    // more data arrives or the receiver stops
+    void idle(bool want_data);
+
+    Receiver& receiver_;
+    HandlerPoolConfig config_;
+    MessageHandler handler_;
+    KeyExtractor key_;
+
+    std::unique_ptr<Slot[]> slots_;   // In-flight messages, by sequence & slot_mask_
+    size_t slot_mask_;
+    std::unique_ptr<Lane[]> lanes_;
+    uint32_t lane_mask_;
+    std::unique_ptr<Queue[]> queues_;  // One per handler thread
+
+    // Receive thread only
+    uint64_t head_ = 0;   // Next sequence to hand out
+    uint64_t tail_ = 0;   // Oldest sequence not yet released
+    uint64_t scan_ = 0;   // Ring position peek_from continues at
+
+    Waiter waiter_;
+
+    std::vector<std::thread> workers_;
+    std::thread receive_thread_;
+    std::atomic<bool> workers_running_{false};
+    std::atomic<size_t> queued_{0};        // Lanes waiting in some queue
+    std::atomic<uint32_t> idle_workers_{0};
+    std::atomic<uint32_t> work_futex_{0};     // Bumped to wake an idle worker
+    std::atomic<uint32_t> handled_futex_{0};  // Bumped when a handler returns
+    std::atomic<uint32_t> receiver_parked_{0};
+
+    std::atomic<uint64_t> dispatched_{0};
+    std::atomic<uint64_t> stalls_{0};
+    std::atomic<uint64_t> handled_{0};
+    std::atomic<uint64_t> steals_{0};
+};
+
+} // namespace swiftchannel
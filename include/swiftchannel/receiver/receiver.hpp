@@ -2,22 +2,39 @@
 
 #include "swiftchannel/common/types.hpp"
 #include "swiftchannel/common/error.hpp"
+#include "swiftchannel/common/executor.hpp"
 #include "swiftchannel/sender/config.hpp"
+#include "swiftchannel/sender/ring_buffer.hpp"
+#include "dispatcher.hpp"
 
 #include <string>
 #include <functional>
 #include <memory>
 #include <thread>
 #include <atomic>
+#include <coroutine>
+#include <span>
+#include <type_traits>
 
 namespace swiftchannel {
 
+class ChannelSet;
+class HandlerPool;
+
 // Receiver implementation (compiled, not header-only)
-// Handles the lifecycle, polling, and message dispatch
+// Handles the lifecycle, polling, and message dispatch. poll() and run()
+// are header-only templates over the ring itself, so their handlers can be
+// inlined; the rest goes through the compiled Impl.
 class Receiver {
 public:
+    // data points directly into the shared ring buffer and is only valid
+    // until the handler returns; copy it out if it must outlive the call
     using MessageHandler = std::function<void(const void* data, size_t size)>;
 
+    // Receives every message of one drained batch at once; the views obey
+    // the same lifetime rule as MessageHandler
+    using BatchHandler = std::function<void(std::span<const MessageView> messages)>;
+
     // Create a receiver for a named channel
     explicit Receiver(const std::string& channel_name,
                      const ChannelConfig& config = {});
@@ -43,8 +60,174 @@ public:
     [[nodiscard]] bool is_running() const noexcept;
 
     // Poll for one message (non-blocking)
+    // Returns ChecksumMismatch if the only message available was corrupted.
     Result<bool> poll_one(MessageHandler handler);
 
+    // poll_one with handler(const void* data, size_t size) inlined
+    // Reads straight from the ring; nothing is allocated or type-erased.
+    // Overwrite channels fall back to poll_one, since they must copy.
+    template<typename Handler>
+    Result<bool> poll(Handler&& handler) {
+        if (ring_ == nullptr) {
+            return Result<bool>(open_error());
+        }
+        if (ring_->overwrites()) {
+            return poll_one(MessageHandler(std::ref(handler)));
+        }
+        ring_->release(header_);  // Whatever next() still holds
+
+        const uint64_t mismatches = ring_->checksum_mismatches();
+        std::span<const uint8_t> payload;
+        if (ring_->try_peek(payload, header_)) {
+            handler(static_cast<const void*>(payload.data()), payload.size());
+            ring_->release(header_);
+            ++inline_messages_;
+            inline_bytes_ += payload.size();
+            return Result<bool>(true);
+        }
+
+        channel_empty();
+        if (ring_->checksum_mismatches() != mismatches) {
+            return Result<bool>(ErrorCode::ChecksumMismatch);
+        }
+        return Result<bool>(false);
+    }
+
+    // start() with handler(const void* data, size_t size) inlined
+    // Handles batches straight from the ring until stop(), waiting as
+    // ChannelConfig::wait_strategy says in between. Overwrite channels
+    // fall back to start().
+    template<typename Handler>
+    Result<void> run(Handler&& handler) {
+        auto entered = enter_run();
+        if (entered.is_error()) {
+            return entered;
+        }
+        if (ring_->overwrites()) {
+            return start(MessageHandler(std::ref(handler)));
+        }
+        ring_->release(header_);  // Whatever next() still holds
+
+        while (is_running()) {
+            size_t bytes = 0;
+            const size_t count = ring_->read_batch(RUN_BATCH,
+                [&](std::span<const uint8_t> payload) {
+                    handler(static_cast<const void*>(payload.data()), payload.size());
+                    bytes += payload.size();
+                }, header_);
+
+            if (count == 0) {
+                idle();
+            } else {
+                inline_messages_ += count;
+                inline_bytes_ += bytes;
+                made_progress();
+            }
+        }
+        return Result<void>();
+    }
+
+    // Result of next() or next_batch(), to be co_awaited
+    // Suspends the awaiting task on the current Executor until messages
+    // arrive; outside one the thread waits as receive() does (no timeout).
+    template<typename Value>
+    class NextAwaiter {
+    public:
+        NextAwaiter(Receiver& receiver, size_t max_messages) noexcept
+            : receiver_(receiver), max_messages_(max_messages) {}
+
+        bool await_ready() noexcept {
+            return attempt();
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            Executor* executor = Executor::current();
+            if (executor == nullptr) {
+                while (!attempt()) {
+                    receiver_.await_data();
+                }
+                return false;  // Waited in place
+            }
+
+            SharedMemoryHeader* header = receiver_.header_;
+            executor->suspend(handle, Readiness{&poll, this,
+                receiver_.ring_->blocking() ? &header->data_futex : nullptr,
+                &header->data_waiters});
+            return true;
+        }
+
+        Result<Value> await_resume() noexcept {
+            if (receiver_.ring_ == nullptr) {
+                return Result<Value>(receiver_.open_error());
+            }
+            return Result<Value>(std::move(value_));
+        }
+
+    private:
+        // Take messages if there are any; true once done
+        bool attempt() noexcept {
+            if (receiver_.ring_ == nullptr) {
+                return true;  // Fails in await_resume
+            }
+            if constexpr (std::is_same_v<Value, MessageView>) {
+                return receiver_.take_next(value_);
+            } else {
+                return receiver_.take_next_batch(max_messages_, value_);
+            }
+        }
+
+        static bool poll(void* self) {
+            auto* awaiter = static_cast<NextAwaiter*>(self);
+            return awaiter->receiver_.ring_->readable(awaiter->receiver_.header_) &&
+                   awaiter->attempt();
+        }
+
+        Receiver& receiver_;
+        size_t max_messages_;
+        Value value_{};
+    };
+
+    // Receive from a coroutine: co_await yields Result<MessageView>
+    // The view points into the ring and stays valid until the next receive
+    // call of any kind on this receiver. See NextAwaiter for how it waits.
+    [[nodiscard]] NextAwaiter<MessageView> next() noexcept {
+        return NextAwaiter<MessageView>(*this, 1);
+    }
+
+    // Like next(), but yields every message available, up to max_messages,
+    // as Result<std::span<const MessageView>> (never empty)
+    [[nodiscard]] NextAwaiter<std::span<const MessageView>> next_batch(
+        size_t max_messages = RUN_BATCH) noexcept {
+        return NextAwaiter<std::span<const MessageView>>(*this, max_messages);
+    }
+
+    // Wait for one message and handle it (blocking)
+    // Waits as ChannelConfig::wait_strategy says; parking needs a channel
+    // created with ChannelConfig::blocking_wait. Returns false if
+    // ChannelConfig::timeout_us passes first (0 waits indefinitely).
+    Result<bool> receive(MessageHandler handler);
+
+    // Handle up to max_messages that are already in the channel (non-blocking)
+    // read_index is published once for the whole batch. Returns the count.
+    Result<size_t> drain(size_t max_messages, MessageHandler handler);
+
+    // Like drain, but hands the whole batch to the handler in one call
+    Result<size_t> drain_batch(size_t max_messages, BatchHandler handler);
+
+    // Like drain, but routes each message by its type id (see Dispatcher)
+    Result<size_t> dispatch(size_t max_messages, Dispatcher& dispatcher);
+
+    // Pollable fd for event loops, readable when messages may be waiting
+    // Needs a channel created with ChannelConfig::notify_fd (else -1; also
+    // -1 if another receiver already has it). Watch it for input; once it
+    // fires, receive until a call comes up empty, which re-arms it.
+    [[nodiscard]] int native_handle();
+
+    // Send time of the message most recently handed to a handler, in
+    // steady_clock nanoseconds (0 if the channel does not take timestamps)
+    // Precision follows the channel's TimestampSource; batches share one stamp.
+    [[nodiscard]] uint64_t last_timestamp_ns() const noexcept;
+
     // Get channel name
     [[nodiscard]] const std::string& channel_name() const noexcept;
 
@@ -54,13 +237,42 @@ public:
         uint64_t bytes_received;
         uint64_t errors;
         uint64_t buffer_full_count;
+        uint64_t overruns;             // Times the sender lapped us (overwrite mode)
+        uint64_t checksum_mismatches;  // Messages dropped as corrupted (checksum mode)
     };
 
     [[nodiscard]] Stats get_stats() const noexcept;
 
 private:
+    friend class ChannelSet;   // Parks on ring_ and header_ alongside other channels
+    friend class HandlerPool;  // Holds ring space until pooled handlers finish
+
+    // Out-of-line pieces of poll() and run(), off their per-message path
+    ErrorCode open_error() const noexcept;
+    Result<void> enter_run();   // Mark running; fails if the channel is not open
+    void idle();                // One idle round of run(), cut short by stop()
+    void made_progress() noexcept;
+    void channel_empty();       // Re-arm native_handle(), if in use
+
+    // Pieces of next() and next_batch(): take messages, held in the ring
+    // until the next receive call (false if there were none), or wait for
+    // some to arrive
+    bool take_next(MessageView& view);
+    bool take_next_batch(size_t max_messages, std::span<const MessageView>& views);
+    void await_data();
+
+    static constexpr size_t RUN_BATCH = 256;
+
     class Impl;
     std::unique_ptr<Impl> impl_;
+
+    // Set once in the constructor (null if the channel did not open)
+    RingBuffer* ring_ = nullptr;
+    SharedMemoryHeader* header_ = nullptr;
+
+    // Messages handled by poll() and run(), added into get_stats()
+    uint64_t inline_messages_ = 0;
+    uint64_t inline_bytes_ = 0;
 };
 
 } // namespace swiftchannel
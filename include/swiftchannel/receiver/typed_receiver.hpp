@@ -0,0 +1,113 @@
+#pragma once
+
+#include "swiftchannel/common/types.hpp"
+#include "swiftchannel/common/error.hpp"
+#include "swiftchannel/sender/config.hpp"
+#include "swiftchannel/sender/channel.hpp"
+#include "swiftchannel/sender/typed_ring_buffer.hpp"
+
+#include <string>
+#include <memory>
+#include <utility>
+
+namespace swiftchannel {
+
+// Receiver for a channel created by TypedSender<T, Capacity>
+// Header-only like the sender, since it is a template; polling only, no
+// background thread. Handlers take const T& and the reference points
+// directly into the ring: it is only valid until the handler returns.
+template<Sendable T, size_t Capacity = 4096>
+class TypedReceiver {
+public:
+    using Ring = TypedRingBuffer<T, Capacity>;
+
+    // Create a receiver for a named typed channel
+    explicit TypedReceiver(const std::string& channel_name,
+                           const ChannelConfig& config = {})
+        : channel_name_(channel_name)
+    {
+        auto result = Channel::open(channel_name, Ring::channel_config(config));
+        if (result.is_ok()) {
+            channel_ = std::make_unique<Channel>(std::move(result.value()));
+            ring_ = std::make_unique<Ring>(channel_->ring_memory());
+        }
+    }
+
+    // Non-copyable, movable
+    TypedReceiver(const TypedReceiver&) = delete;
+    TypedReceiver& operator=(const TypedReceiver&) = delete;
+    TypedReceiver(TypedReceiver&&) noexcept = default;
+    TypedReceiver& operator=(TypedReceiver&&) noexcept = default;
+
+    // Check if receiver is ready
+    [[nodiscard]] bool is_ready() const noexcept {
+        return channel_ && channel_->is_open();
+    }
+
+    // Copy the next value out, if any (non-blocking)
+    Result<bool> try_receive(T& value) noexcept {
+        if (!is_ready()) {
+            return Result<bool>(ErrorCode::ChannelNotFound);
+        }
+
+        if (!ring_->try_read(value, channel_->header())) {
+            return Result<bool>(false);
+        }
+
+        stats_.messages_received++;
+        return Result<bool>(true);
+    }
+
+    // Poll for one value (non-blocking)
+    template<typename Handler>
+    Result<bool> poll_one(Handler&& handler) {
+        auto count = drain(1, std::forward<Handler>(handler));
+        if (count.is_error()) {
+            return Result<bool>(count.error());
+        }
+        return Result<bool>(count.value() != 0);
+    }
+
+    // Handle up to max_messages values already in the channel (non-blocking)
+    // read_index is published once for the whole batch. Returns the count.
+    template<typename Handler>
+    Result<size_t> drain(size_t max_messages, Handler&& handler) {
+        if (!is_ready()) {
+            return Result<size_t>(ErrorCode::ChannelNotFound);
+        }
+
+        const size_t count = ring_->read_batch(max_messages, handler, channel_->header());
+        stats_.messages_received += count;
+        return Result<size_t>(size_t{count});
+    }
+
+    // Get number of values waiting to be read
+    [[nodiscard]] size_t available() const noexcept {
+        if (!is_ready()) {
+            return 0;
+        }
+        return ring_->available_read(channel_->header());
+    }
+
+    // Get channel name
+    [[nodiscard]] const std::string& channel_name() const noexcept {
+        return channel_name_;
+    }
+
+    // Get statistics
+    struct Stats {
+        uint64_t messages_received;
+    };
+
+    [[nodiscard]] Stats get_stats() const noexcept {
+        return stats_;
+    }
+
+private:
+    std::string channel_name_;
+    std::unique_ptr<Channel> channel_;
+    std::unique_ptr<Ring> ring_;
+    Stats stats_{};
+};
+
+} // namespace swiftchannel
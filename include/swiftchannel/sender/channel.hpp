@@ -4,6 +4,7 @@
 #include "../common/error.hpp"
 #include "config.hpp"
 #include "ring_buffer.hpp"
+#include "notify.hpp"
 
 #include <string>
 #include <memory>
@@ -20,8 +21,8 @@ public:
     // Non-copyable, movable
     Channel(const Channel&) = delete;
     Channel& operator=(const Channel&) = delete;
-    Channel(Channel&&) noexcept = default;
-    Channel& operator=(Channel&&) noexcept = default;
+    Channel(Channel&& other) noexcept;
+    Channel& operator=(Channel&& other) noexcept;
 
     // Open or create a channel
     [[nodiscard]] static Result<Channel> open(const std::string& name,
@@ -42,6 +43,12 @@ public:
         return header_;
     }
 
+    // Get the start of the ring area (right after the header)
+    [[nodiscard]] void* ring_memory() noexcept {
+        return reinterpret_cast<uint8_t*>(header_) +
+               align_up(sizeof(SharedMemoryHeader), CACHE_LINE_SIZE);
+    }
+
     // Close the channel
     void close() noexcept;
 
@@ -66,6 +73,7 @@ private:
     size_t total_size_ = 0;
     SharedMemoryHeader* header_ = nullptr;
     std::unique_ptr<RingBuffer> ring_buffer_;
+    std::unique_ptr<NotifySender> notifier_;  // ChannelFlags::NotifyFd only
     void* platform_handle_ = nullptr;  // Platform-specific handle
 };
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../common/types.hpp"
+
 #include <cstddef>
 #include <cstdint>
 
@@ -17,6 +19,8 @@ struct ChannelConfig {
     uint64_t flags = 0;
 
     // Timeout for operations (microseconds, 0 = no timeout)
+    // Bounds how long Receiver::receive waits for a message and
+    // Sender::send_blocking waits for space.
     uint64_t timeout_us = 0;
 
     // Enable checksum validation
@@ -25,6 +29,52 @@ struct ChannelConfig {
     // Overwrite behavior when buffer is full
     bool overwrite_on_full = false;
 
+    // Source of message timestamps
+    TimestampSource timestamp_source = TimestampSource::SteadyClock;
+
+    // Leave unused fields out of record headers (see RecordLayout)
+    bool compact_framing = false;
+
+    // Keep type ids (see Dispatcher) in compact record headers; full
+    // framing always has room for them
+    bool type_ids = false;
+
+    // Let idle receivers (and senders facing a full ring) sleep on a futex
+    // instead of polling. Every publish and every release then costs one
+    // full fence to check for sleepers; the wake system call is only made
+    // when the other side is actually parked.
+    bool blocking_wait = false;
+
+    // Let the receiver wait in an event loop: Receiver::native_handle()
+    // becomes readable when messages arrive. Costs producers the same
+    // fence per publish as blocking_wait, plus a write when the receiver
+    // is waiting. One receiver per channel gets the fd.
+    bool notify_fd = false;
+
+    // How this side waits when idle (local; not part of the channel)
+    WaitStrategy wait_strategy = WaitStrategy::Adaptive;
+    uint64_t wait_sleep_us = 50;  // For WaitStrategy::Sleep
+
+    // Back the channel with huge pages: hugetlbfs (/dev/hugepages) when it
+    // has free pages, else transparent huge pages where the kernel allows
+    bool huge_pages = false;
+
+    // Fault every page in at open instead of on the first messages
+    bool prefault = false;
+
+    // Lock the channel in RAM; open fails if RLIMIT_MEMLOCK is too low
+    bool lock_memory = false;
+
+    // NUMA placement of the channel's pages (Linux)
+    // With ConsumerNode, the sender leaves placement to the receiver, which
+    // binds the pages to its own node when it opens the channel.
+    NumaPolicy numa_policy = NumaPolicy::Default;
+    int numa_node = 0;  // Node for NumaPolicy::Bind
+
+    // Fixed slot size of a typed channel (0 = variable-size records)
+    // Set by TypedSender/TypedReceiver; both sides must agree.
+    uint32_t slot_size = 0;
+
     // Validate configuration
     constexpr bool is_valid() const noexcept {
         // Ring buffer size must be power of 2
@@ -32,6 +82,27 @@ struct ChannelConfig {
             return false;
         }
 
+        // No flags this version cannot honour
+        if ((channel_flags() & ~KNOWN_CHANNEL_FLAGS) != 0) {
+            return false;
+        }
+
+        // Binding needs a real node
+        if (numa_policy == NumaPolicy::Bind && numa_node < 0) {
+            return false;
+        }
+
+        // Typed channels hold plain SPSC slots; the record limits do not apply
+        if (slot_size != 0) {
+            return slot_size <= ring_buffer_size &&
+                   !has_flag(channel_flags(), ChannelFlags::MultiProducer) &&
+                   !has_flag(channel_flags(), ChannelFlags::Broadcast) &&
+                   !has_flag(channel_flags(), ChannelFlags::Overwrite) &&
+                   !has_flag(channel_flags(), ChannelFlags::Checksum) &&
+                   !has_flag(channel_flags(), ChannelFlags::BlockingWait) &&
+                   !has_flag(channel_flags(), ChannelFlags::NotifyFd);
+        }
+
         // Max message size must fit in ring buffer
         if (max_message_size >= ring_buffer_size / 2) {
             return false;
@@ -42,9 +113,55 @@ struct ChannelConfig {
             return false;
         }
 
+        // Broadcast consumers and overwriting producers cannot keep the
+        // ring zeroed, which the multi-producer commit protocol relies on
+        const uint64_t effective = channel_flags();
+        if (has_flag(effective, ChannelFlags::MultiProducer) &&
+            (has_flag(effective, ChannelFlags::Broadcast) ||
+             has_flag(effective, ChannelFlags::Overwrite))) {
+            return false;
+        }
+
         return true;
     }
 
+    // Flags recorded in the header when this config creates a channel
+    constexpr uint64_t channel_flags() const noexcept {
+        uint64_t result = flags;
+        if (overwrite_on_full) {
+            result |= static_cast<uint64_t>(ChannelFlags::Overwrite);
+        }
+        if (enable_checksum) {
+            result |= static_cast<uint64_t>(ChannelFlags::Checksum);
+        }
+        if (compact_framing) {
+            result |= static_cast<uint64_t>(ChannelFlags::CompactFraming);
+        }
+        if (type_ids) {
+            result |= static_cast<uint64_t>(ChannelFlags::TypeIds);
+        }
+        if (blocking_wait) {
+            result |= static_cast<uint64_t>(ChannelFlags::BlockingWait);
+        }
+        if (notify_fd) {
+            result |= static_cast<uint64_t>(ChannelFlags::NotifyFd);
+        }
+        switch (timestamp_source) {
+            case TimestampSource::Tsc:
+                result |= static_cast<uint64_t>(ChannelFlags::TscTimestamp);
+                break;
+            case TimestampSource::Coarse:
+                result |= static_cast<uint64_t>(ChannelFlags::CoarseTimestamp);
+                break;
+            case TimestampSource::None:
+                result |= static_cast<uint64_t>(ChannelFlags::NoTimestamp);
+                break;
+            case TimestampSource::SteadyClock:
+                break;
+        }
+        return result;
+    }
+
 private:
     static constexpr bool is_power_of_two(size_t value) noexcept {
         return value != 0 && (value & (value - 1)) == 0;
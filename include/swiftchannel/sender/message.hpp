@@ -47,6 +47,7 @@ public:
                 static_cast<const uint8_t*>(data) + size) {}
 
     template<typename T>
+        requires (!std::is_integral_v<T>)
     explicit DynamicMessage(const T& value)
         : data_(sizeof(T)) {
         static_assert(std::is_trivially_copyable_v<T>);
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../common/types.hpp"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace swiftchannel {
+
+// Event-loop notification for ChannelFlags::NotifyFd channels
+// The receiver owns an eventfd and hands it to producers over a Unix domain
+// socket named after the channel (see socket_posix.cpp). A receiver that
+// finds the channel empty arms it in the header; the next producer to
+// publish disarms it and writes the eventfd, so a busy channel costs no
+// system calls and the fd becomes readable exactly when data shows up.
+
+// Producer end: asks for the receiver's eventfd when the channel is opened
+// and signals it. The request is a non-blocking connect; the receiver
+// answers it the next time it finds the channel empty, and the answer is
+// picked up without waiting, so publishing never blocks on the receiver.
+class NotifySender {
+public:
+    // generation: the channel's notify_generation when it was opened
+    NotifySender(std::string channel_name, uint32_t generation) noexcept;
+    ~NotifySender();
+
+    NotifySender(const NotifySender&) = delete;
+    NotifySender& operator=(const NotifySender&) = delete;
+
+    // Make the receiver's fd readable
+    // The header's notify_generation identifies the receiver that armed the
+    // channel; a new one gets a new request. The fd is only taken from the
+    // process recorded as receiver_pid, running as our user. Without an fd
+    // yet the signal is skipped: the pending request keeps the receiver's
+    // handle readable, so no notification is lost.
+    void signal(SharedMemoryHeader* header) noexcept;
+
+private:
+    void request() noexcept;
+
+    std::string channel_name_;
+    int fd_ = -1;         // The receiver's eventfd, once it has answered
+    int request_ = -1;    // Connection the answer arrives on
+    uint32_t generation_ = 0;
+};
+
+} // namespace swiftchannel
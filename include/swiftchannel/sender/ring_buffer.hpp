@@ -2,23 +2,98 @@
 
 #include "../common/types.hpp"
 #include "../common/alignment.hpp"
+#include "../common/checksum.hpp"
+#include "../common/futex.hpp"
+#include "../common/timestamp.hpp"
+#include "notify.hpp"
+#include <algorithm>
 #include <atomic>
+#include <cerrno>
 #include <cstring>
 #include <bit>
-#include <chrono>
 #include <cassert>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#ifndef _WIN32
+#include <signal.h>
+#include <sys/types.h>
+#endif
 
 namespace swiftchannel {
 
+// Check whether a process still exists (to reclaim a dead consumer's cursor)
+// A process we may not signal counts as alive; Windows is not checked.
+inline bool process_alive(uint32_t pid) noexcept {
+#ifdef _WIN32
+    (void)pid;
+    return true;
+#else
+    return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+#endif
+}
+
 // Lock-free SPSC (Single Producer Single Consumer) ring buffer
 // Optimized for cache-line alignment and false sharing prevention
+//
+// Records are always contiguous in memory: when a record does not fit in the
+// space left before the end of the ring, the writer fills that tail with a
+// padding record and starts the message at offset 0. This lets callers
+// serialize directly into the ring (try_reserve/commit).
+//
+// Every record is committed by a release store of its magic word, written
+// after the rest of the record. With ChannelFlags::MultiProducer, producers
+// claim space with a CAS on write_index and the consumer relies on the magic
+// word alone to know a record is complete, so write_index never has to wait
+// for slower producers. The consumer zeroes what it consumed, which requires
+// the ring to start out zeroed.
+//
+// With ChannelFlags::Broadcast, each consumer attaches its own cursor in the
+// header and the producer's free space is bounded by the slowest attached
+// cursor instead of read_index.
+//
+// With ChannelFlags::Overwrite, the producer never waits for a consumer: it
+// evicts the oldest records instead and publishes the first intact one in
+// oldest_index before touching their bytes, seqlock style. A consumer that
+// finds its position below oldest_index (before or after copying a record)
+// was lapped and resyncs there. Records can be overwritten while being read,
+// so only the copying try_read is available in this mode.
+//
+// With ChannelFlags::Checksum, each record carries the CRC32C of its payload,
+// computed while copying it in and checked while copying it out. Records
+// that fail the check are dropped and counted.
+//
+// Records are stamped from the channel's TimestampSource (see timestamp.hpp);
+// a batch shares a single stamp.
+//
+// With ChannelFlags::BlockingWait, idle consumers may park on the futex word
+// in the header; producers check for them after every publish and make the
+// wake system call only when one is parked. Producers waiting for space park
+// on a second word the same way, checked by consumers after every release.
+// ChannelFlags::NotifyFd signals the receiver's eventfd along the same lines
+// (see notify.hpp).
+//
+// The record header layout is worked out from the flags once, in the
+// constructor (see RecordLayout). With ChannelFlags::CompactFraming a small
+// record is as short as 16 bytes instead of 40.
 class RingBuffer {
 public:
+    // Wildcard for reclaim_dead_cursors
+    static constexpr uint64_t ANY_POSITION = ~0ull;
+
     RingBuffer() = delete;
-    RingBuffer(void* memory, size_t size) noexcept
+    RingBuffer(void* memory, size_t size, uint64_t flags = 0) noexcept
         : buffer_(static_cast<uint8_t*>(memory))
         , size_(size)
         , mask_(size - 1)
+        , multi_producer_(has_flag(flags, ChannelFlags::MultiProducer))
+        , broadcast_(has_flag(flags, ChannelFlags::Broadcast))
+        , overwrite_(has_flag(flags, ChannelFlags::Overwrite))
+        , checksum_(has_flag(flags, ChannelFlags::Checksum))
+        , blocking_(has_flag(flags, ChannelFlags::BlockingWait))
+        , timestamp_source_(swiftchannel::timestamp_source(flags))
+        , layout_(RecordLayout::for_flags(flags))
     {
         // Size must be power of 2
         assert(is_power_of_two(size));
@@ -26,134 +101,959 @@ public:
     }
 
     // Try to write data to the ring buffer (non-blocking, header-only)
+    // type_id tags the record for Dispatcher (0 = untyped).
     [[nodiscard]] inline bool try_write(const void* data, size_t data_size,
-                                        SharedMemoryHeader* header) noexcept {
-        const size_t total_size = sizeof(MessageHeader) + align_up(data_size, 8);
-
-        // Check if we have enough space
-        const uint64_t current_write = header->write_index.load(std::memory_order_relaxed);
-        const uint64_t current_read = header->read_index.load(std::memory_order_acquire);
-
-        const uint64_t available = size_ - (current_write - current_read);
-        if (available < total_size) {
+                                        SharedMemoryHeader* header,
+                                        uint32_t type_id = 0) noexcept {
+        std::span<uint8_t> payload;
+        if (!try_reserve(data_size, payload, header)) {
             return false;  // Buffer full
         }
 
-        // Write message header
-        MessageHeader msg_header{};
-        msg_header.magic = MessageHeader::MAGIC;
-        msg_header.size = static_cast<uint32_t>(data_size);
-        msg_header.sequence = current_write;
-        msg_header.timestamp = get_timestamp_ns();
-        msg_header.checksum = 0;  // TODO: compute if enabled
-        msg_header.reserved = 0;
+        const uint32_t checksum = copy_payload(payload.data(), data, data_size);
+        publish_reservation(data_size, checksum, type_id, header);
+        return true;
+    }
+
+    // Reserve space for a message of up to max_size bytes (zero-copy write)
+    // On success, payload points directly into the ring. Nothing is visible
+    // to the reader until commit() is called.
+    [[nodiscard]] inline bool try_reserve(size_t max_size, std::span<uint8_t>& payload,
+                                          SharedMemoryHeader* header) noexcept {
+        cancel();  // A new reservation replaces an abandoned one
 
-        // Write header to ring buffer
-        write_bytes(&msg_header, sizeof(msg_header), current_write);
+        const size_t total_size = record_size(max_size);
 
-        // Write payload
-        write_bytes(data, data_size, current_write + sizeof(msg_header));
+        uint64_t current_write = header->write_index.load(std::memory_order_relaxed);
+        size_t skip = 0;
 
-        // Update write index (release semantics for visibility)
-        header->write_index.store(current_write + total_size, std::memory_order_release);
+        for (;;) {
+            const size_t tail = size_ - offset(current_write);
+            skip = (tail < total_size) ? tail : 0;
+
+            if (overwrite_) {
+                evict(current_write, skip + total_size, header);
+                break;
+            }
 
+            // Check if we have enough space (including any padding at the end)
+            // Only touch the consumer's cache line when the cached read index
+            // says the buffer is full.
+            if (!fits(current_write, cached_read_, skip + total_size)) {
+                refresh_read_position(current_write, header);
+                if (!fits(current_write, cached_read_, skip + total_size)) {
+                    return false;  // Buffer full
+                }
+            }
+
+            if (!multi_producer_) {
+                break;
+            }
+
+            // Claim the space; on failure current_write holds the new value
+            if (header->write_index.compare_exchange_weak(
+                    current_write, current_write + skip + total_size,
+                    std::memory_order_relaxed, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        if (skip != 0) {
+            write_padding(current_write, skip);
+        }
+
+        reserved_index_ = current_write + skip;
+        reserved_size_ = max_size;
+        has_reservation_ = true;
+
+        payload = {record_payload(reserved_index_), max_size};
         return true;
     }
 
+    // Publish the reserved message with its final payload size
+    // data_size must not exceed the size passed to try_reserve. With
+    // checksums enabled, the payload is read once more to compute its CRC.
+    inline void commit(size_t data_size, SharedMemoryHeader* header,
+                       uint32_t type_id = 0) noexcept {
+        assert(has_reservation_ && data_size <= reserved_size_);
+
+        const uint32_t checksum =
+            checksum_ ? crc32c(record_payload(reserved_index_), data_size) : 0;
+        publish_reservation(data_size, checksum, type_id, header);
+    }
+
+    // Drop the pending reservation, if any
+    // In multi-producer mode the claimed space is already part of the ring,
+    // so it is turned into padding for the consumer to skip.
+    inline void cancel() noexcept {
+        if (!has_reservation_) {
+            return;
+        }
+
+        if (multi_producer_) {
+            write_padding(reserved_index_, record_size(reserved_size_));
+        }
+        has_reservation_ = false;
+    }
+
+    // Write up to count messages and publish them with a single store
+    // payload_at(i) returns the i-th payload as a std::span<const uint8_t>.
+    // All messages share one timestamp and type id. With all_or_nothing,
+    // nothing is published unless every message fits. Returns the number
+    // written.
+    template<typename PayloadAt>
+    [[nodiscard]] inline size_t try_write_batch(size_t count, PayloadAt&& payload_at,
+                                                SharedMemoryHeader* header,
+                                                bool all_or_nothing = false,
+                                                uint32_t type_id = 0) noexcept {
+        uint64_t start = header->write_index.load(std::memory_order_relaxed);
+        uint64_t end = start;
+        size_t planned = 0;
+        bool refreshed = false;
+
+        // Work out how many records fit, then claim them in one step
+        for (;;) {
+            end = start;
+            for (planned = 0; planned < count; ++planned) {
+                const size_t total_size = record_size(payload_at(planned).size());
+                const size_t tail = size_ - offset(end);
+                const size_t skip = (tail < total_size) ? tail : 0;
+                const size_t needed = static_cast<size_t>(end - start) + skip + total_size;
+
+                // Refresh the cached read index at most once per batch;
+                // when overwriting, only the ring size limits a batch
+                if (overwrite_ ? needed > size_ : !fits(start, cached_read_, needed)) {
+                    if (overwrite_ || refreshed) {
+                        break;
+                    }
+                    refresh_read_position(start, header);
+                    refreshed = true;
+                    if (!fits(start, cached_read_, needed)) {
+                        break;
+                    }
+                }
+
+                end += skip + total_size;
+            }
+
+            if (planned == 0 || (all_or_nothing && planned < count)) {
+                return 0;  // Nothing published
+            }
+
+            // Another producer moved write_index: plan again from there
+            if (!multi_producer_ ||
+                header->write_index.compare_exchange_weak(start, end,
+                                                          std::memory_order_relaxed,
+                                                          std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        if (overwrite_) {
+            evict(start, static_cast<size_t>(end - start), header);
+        }
+
+        const uint64_t timestamp = take_timestamp(timestamp_source_);
+        uint64_t current_write = start;
+
+        for (size_t i = 0; i < planned; ++i) {
+            const std::span<const uint8_t> payload = payload_at(i);
+            const size_t total_size = record_size(payload.size());
+
+            const size_t tail = size_ - offset(current_write);
+            if (tail < total_size) {
+                write_padding(current_write, tail);
+                current_write += tail;
+            }
+
+            const uint32_t checksum = copy_payload(record_payload(current_write),
+                                                   payload.data(), payload.size());
+            write_header(current_write, payload.size(), timestamp, checksum, type_id);
+            current_write += total_size;
+        }
+
+        // One release store makes the whole batch visible
+        if (!multi_producer_) {
+            header->write_index.store(end, std::memory_order_release);
+        }
+        notify_consumers(header);
+        return planned;
+    }
+
+    // Check whether a reservation is waiting to be committed
+    [[nodiscard]] bool has_reservation() const noexcept {
+        return has_reservation_;
+    }
+
+    // Size of the pending reservation
+    [[nodiscard]] size_t reserved_size() const noexcept {
+        return reserved_size_;
+    }
+
     // Read data from ring buffer (used by receiver)
     [[nodiscard]] inline bool try_read(void* data, size_t& data_size,
                                        SharedMemoryHeader* header) noexcept {
-        const uint64_t current_read = header->read_index.load(std::memory_order_relaxed);
-        const uint64_t current_write = header->write_index.load(std::memory_order_acquire);
+        if (overwrite_) {
+            return try_read_lapped(data, data_size, header);
+        }
 
-        // Check if data is available
-        if (current_read >= current_write) {
-            return false;  // Buffer empty
+        for (;;) {
+            uint64_t current_read = 0;
+            if (!next_message(current_read, header)) {
+                return false;  // Buffer empty or corrupted
+            }
+
+            // Check if caller's buffer is large enough
+            const uint32_t size = size_at(current_read);
+            if (size > data_size) {
+                data_size = size;  // Return required size
+                return false;
+            }
+
+            // Read payload
+            const uint32_t checksum = copy_payload(data, record_payload(current_read), size);
+            const uint64_t next = current_read + record_size(size);
+            const RecordFields fields = load_fields(current_read);
+            if (!verify(fields.checksum, checksum)) {
+                publish_read(current_read, next, header);
+                continue;  // Dropped
+            }
+            data_size = size;
+            last_timestamp_ = fields.timestamp;
+            last_type_id_ = fields.type_id;
+
+            // Update read index
+            publish_read(current_read, next, header);
+            return true;
         }
+    }
 
-        // Read message header
-        MessageHeader msg_header{};
-        read_bytes(&msg_header, sizeof(msg_header), current_read);
+    // Peek at the next message without consuming it (zero-copy read)
+    // On success, payload points directly into the ring and stays valid
+    // until release() is called. Not available in overwrite mode.
+    [[nodiscard]] inline bool try_peek(std::span<const uint8_t>& payload,
+                                       SharedMemoryHeader* header) noexcept {
+        assert(!overwrite_);
+
+        for (;;) {
+            uint64_t current_read = 0;
+            if (!next_message(current_read, header)) {
+                return false;  // Buffer empty or corrupted
+            }
 
-        // Validate header
-        if (msg_header.magic != MessageHeader::MAGIC) {
-            return false;  // Corrupted
+            const uint32_t size = size_at(current_read);
+            const uint64_t next = current_read + record_size(size);
+            const RecordFields fields = load_fields(current_read);
+            if (checksum_ && !verify(fields.checksum,
+                                     crc32c(record_payload(current_read), size))) {
+                publish_read(current_read, next, header);
+                continue;  // Dropped
+            }
+
+            payload = {record_payload(current_read), size};
+            peeked_end_ = next;
+            last_timestamp_ = fields.timestamp;
+            last_type_id_ = fields.type_id;
+            return true;
         }
+    }
 
-        // Check if caller's buffer is large enough
-        if (msg_header.size > data_size) {
-            data_size = msg_header.size;  // Return required size
-            return false;
+    // Consume the message(s) returned by the last successful try_peek/peek_batch
+    inline void release(SharedMemoryHeader* header) noexcept {
+        const uint64_t current_read = read_position(header).load(std::memory_order_relaxed);
+        if (peeked_end_ > current_read) {
+            publish_read(current_read, peeked_end_, header);
         }
+    }
+
+    // Peek at up to max_messages visible at a single write_index snapshot
+    // fn(payload) is called for each message with a view into the ring.
+    // The views stay valid until release(), which publishes read_index once
+    // for the whole batch. Returns the number of messages visited.
+    // Not available in overwrite mode.
+    template<typename Fn>
+    inline size_t peek_batch(size_t max_messages, Fn&& fn, SharedMemoryHeader* header) {
+        uint64_t position = read_position(header).load(std::memory_order_relaxed);
+        const size_t count = peek_from(position, max_messages,
+            [&](std::span<const uint8_t> payload, uint64_t) { fn(payload); }, header);
+        peeked_end_ = position;
+        return count;
+    }
 
-        // Read payload
-        read_bytes(data, msg_header.size, current_read + sizeof(msg_header));
+    // peek_batch starting at position rather than the read position, so a
+    // consumer can look past messages it still holds
+    // fn(payload, end) also gets the position just past each message; pass
+    // one to release_to() once everything up to it is done with. position
+    // is advanced past every record visited. Not available in overwrite mode.
+    template<typename Fn>
+    inline size_t peek_from(uint64_t& position, size_t max_messages, Fn&& fn,
+                            SharedMemoryHeader* header) {
+        assert(!overwrite_);
 
-        // Update read index
-        const size_t total_size = sizeof(MessageHeader) + align_up(msg_header.size, 8);
-        header->read_index.store(current_read + total_size, std::memory_order_release);
+        uint64_t current_read = position;
+        cached_write_ = header->write_index.load(std::memory_order_acquire);
 
-        data_size = msg_header.size;
-        return true;
+        size_t count = 0;
+        while (count < max_messages && current_read < cached_write_) {
+            const uint32_t magic = magic_at(current_read);
+            const uint32_t size = size_at(current_read);
+
+            // Skip padding at the end of the ring
+            if (magic == MessageHeader::PADDING) {
+                current_read += size;
+                continue;
+            }
+
+            // Validate header
+            if (magic != MessageHeader::MAGIC) {
+                break;  // Not committed yet (multi-producer) or corrupted
+            }
+
+            // Dropped records are released along with the batch
+            const RecordFields fields = load_fields(current_read);
+            if (checksum_ && !verify(fields.checksum,
+                                     crc32c(record_payload(current_read), size))) {
+                current_read += record_size(size);
+                continue;
+            }
+
+            last_timestamp_ = fields.timestamp;
+            last_type_id_ = fields.type_id;
+            const uint64_t next = current_read + record_size(size);
+            fn(std::span<const uint8_t>(record_payload(current_read), size), next);
+            current_read = next;
+            ++count;
+        }
+
+        position = current_read;
+        return count;
+    }
+
+    // Consume everything before position (an end from peek_from)
+    inline void release_to(uint64_t position, SharedMemoryHeader* header) noexcept {
+        const uint64_t current_read = read_position(header).load(std::memory_order_relaxed);
+        if (position > current_read) {
+            publish_read(current_read, position, header);
+        }
+    }
+
+    // This consumer's read position (where peek_from starts a fresh scan)
+    [[nodiscard]] inline uint64_t read_cursor(SharedMemoryHeader* header) const noexcept {
+        return read_position(header).load(std::memory_order_relaxed);
+    }
+
+    // Consume up to max_messages with a single read_index publish
+    template<typename Fn>
+    inline size_t read_batch(size_t max_messages, Fn&& fn, SharedMemoryHeader* header) {
+        const size_t count = peek_batch(max_messages, std::forward<Fn>(fn), header);
+        release(header);
+        return count;
     }
 
     // Get available space for writing
-    [[nodiscard]] inline size_t available_write_space(const SharedMemoryHeader* header) const noexcept {
+    [[nodiscard]] inline size_t available_write_space(SharedMemoryHeader* header) const noexcept {
         const uint64_t current_write = header->write_index.load(std::memory_order_relaxed);
-        const uint64_t current_read = header->read_index.load(std::memory_order_acquire);
+        const uint64_t current_read = load_read_position(current_write, header);
         return size_ - static_cast<size_t>(current_write - current_read);
     }
 
     // Get available data for reading
-    [[nodiscard]] inline size_t available_read_data(const SharedMemoryHeader* header) const noexcept {
-        const uint64_t current_read = header->read_index.load(std::memory_order_relaxed);
+    [[nodiscard]] inline size_t available_read_data(SharedMemoryHeader* header) const noexcept {
+        const uint64_t current_read = read_position(header).load(std::memory_order_relaxed);
         const uint64_t current_write = header->write_index.load(std::memory_order_acquire);
         return static_cast<size_t>(current_write - current_read);
     }
 
+    // Check whether a message (or padding) is ready at the read position
+    [[nodiscard]] inline bool readable(SharedMemoryHeader* header) const noexcept {
+        const uint64_t current_read = read_position(header).load(std::memory_order_relaxed);
+        if (current_read >= header->write_index.load(std::memory_order_acquire)) {
+            return false;
+        }
+        // Multi-producer space can be claimed before its record is committed
+        return !multi_producer_ || magic_at(current_read) != 0;
+    }
+
+    // Park until data may be readable, for at most timeout_ns (0 = no limit)
+    // Returns at once if data is readable or interrupted() is true once this
+    // consumer is registered as a waiter; otherwise it sleeps until a
+    // producer or wake_consumers() wakes it. Spurious returns are possible.
+    // Only for ChannelFlags::BlockingWait channels.
+    template<typename Interrupted>
+    inline void wait_for_data(SharedMemoryHeader* header, uint64_t timeout_ns,
+                              Interrupted&& interrupted) noexcept {
+        assert(blocking_);
+
+        // A wake after this load makes futex_wait return immediately; a
+        // publish before the waiter count goes up is seen by the re-check
+        const uint32_t seq = header->data_futex.load(std::memory_order_acquire);
+        header->data_waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);  // Pairs with notify_consumers
+
+        if (!readable(header) && !interrupted()) {
+            futex_wait(&header->data_futex, seq, timeout_ns);
+        }
+        header->data_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // Wake every parked consumer, whether or not there is data
+    inline void wake_consumers(SharedMemoryHeader* header) noexcept {
+        header->data_futex.fetch_add(1, std::memory_order_release);
+        futex_wake_all(&header->data_futex);
+    }
+
+    // Oldest position still needed by a consumer (producer side)
+    // Moves when consumers free space; a full producer waits for that.
+    [[nodiscard]] inline uint64_t consumer_position(SharedMemoryHeader* header) const noexcept {
+        return load_read_position(header->write_index.load(std::memory_order_relaxed), header);
+    }
+
+    // Park until consumer_position() moves past seen, for at most timeout_ns
+    // (0 = no limit). The producer-side twin of wait_for_data, with the
+    // same rules. Only for ChannelFlags::BlockingWait channels.
+    template<typename Interrupted>
+    inline void wait_for_space(SharedMemoryHeader* header, uint64_t seen, uint64_t timeout_ns,
+                               Interrupted&& interrupted) noexcept {
+        assert(blocking_);
+
+        const uint32_t seq = header->space_futex.load(std::memory_order_acquire);
+        header->space_waiters.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);  // Pairs with notify_producers
+
+        if (consumer_position(header) == seen && !interrupted()) {
+            futex_wait(&header->space_futex, seq, timeout_ns);
+        }
+        header->space_waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    // Wake every parked producer, whether or not there is space
+    inline void wake_producers(SharedMemoryHeader* header) noexcept {
+        header->space_futex.fetch_add(1, std::memory_order_release);
+        futex_wake_all(&header->space_futex);
+    }
+
+    // Check whether idle consumers may park (ChannelFlags::BlockingWait)
+    [[nodiscard]] bool blocking() const noexcept {
+        return blocking_;
+    }
+
+    // Signal an armed receiver's eventfd after each publish (producer side)
+    // Set by Channel on ChannelFlags::NotifyFd channels; nullptr disables.
+    void set_notifier(NotifySender* notifier) noexcept {
+        notifier_ = notifier;
+    }
+
+    // Claim a broadcast cursor for this consumer, starting at the live tail
+    // Returns false if every cursor is held by a live process; cursors of
+    // consumers that died without detaching are reclaimed. No-op for other
+    // channels.
+    [[nodiscard]] inline bool attach_consumer(SharedMemoryHeader* header, uint32_t pid) noexcept {
+        if (!broadcast_ || cursor_) {
+            return true;
+        }
+
+        for (int pass = 0; pass < 2; ++pass) {
+            for (auto& cursor : header->cursors) {
+                uint32_t expected = ConsumerCursor::FREE;
+                if (cursor.state.compare_exchange_strong(expected, ConsumerCursor::ACTIVE,
+                                                         std::memory_order_seq_cst)) {
+                    // Either the producer sees this cursor on its next refresh,
+                    // or it published writes we now start after; both are safe
+                    cursor.pid.store(pid, std::memory_order_release);
+                    cursor.position.store(header->write_index.load(std::memory_order_seq_cst),
+                                          std::memory_order_release);
+                    cursor_ = &cursor;
+                    return true;
+                }
+            }
+            if (reclaim_dead_cursors(header) == 0) {
+                break;
+            }
+        }
+
+        return false;
+    }
+
+    // Give the broadcast cursor back so it no longer holds the producer
+    inline void detach_consumer() noexcept {
+        if (cursor_) {
+            cursor_->pid.store(0, std::memory_order_relaxed);
+            cursor_->state.store(ConsumerCursor::FREE, std::memory_order_release);
+            cursor_ = nullptr;
+        }
+    }
+
+    // Free the cursors of consumers whose process exited without detaching
+    // (only those at position, unless it is ANY_POSITION); returns how many
+    // Whoever swaps the dead pid for 0 frees the cursor, so one that was
+    // freed and claimed again in the meantime is left alone.
+    inline size_t reclaim_dead_cursors(SharedMemoryHeader* header,
+                                       uint64_t position = ANY_POSITION) noexcept {
+        size_t reclaimed = 0;
+        for (auto& cursor : header->cursors) {
+            if (cursor.state.load(std::memory_order_acquire) != ConsumerCursor::ACTIVE ||
+                (position != ANY_POSITION &&
+                 cursor.position.load(std::memory_order_acquire) != position)) {
+                continue;
+            }
+            uint32_t pid = cursor.pid.load(std::memory_order_acquire);
+            if (pid == 0 || process_alive(pid)) {
+                continue;
+            }
+            if (cursor.pid.compare_exchange_strong(pid, 0, std::memory_order_acq_rel)) {
+                cursor.state.store(ConsumerCursor::FREE, std::memory_order_release);
+                ++reclaimed;
+            }
+        }
+        return reclaimed;
+    }
+
+    // Check whether every consumer has its own cursor (ChannelFlags::Broadcast)
+    [[nodiscard]] bool broadcasts() const noexcept {
+        return broadcast_;
+    }
+
+    // Check whether the producer overwrites unread records when full
+    [[nodiscard]] bool overwrites() const noexcept {
+        return overwrite_;
+    }
+
+    // Raw timestamp of the message most recently read or peeked
+    // Convert with to_steady_ns(); 0 if the channel does not take timestamps.
+    [[nodiscard]] uint64_t last_timestamp() const noexcept {
+        return last_timestamp_;
+    }
+
+    // Type id of the message most recently read or peeked (0 if untyped)
+    [[nodiscard]] uint32_t last_type_id() const noexcept {
+        return last_type_id_;
+    }
+
+    // Number of records dropped because their checksum did not match
+    [[nodiscard]] uint64_t checksum_mismatches() const noexcept {
+        return checksum_mismatches_;
+    }
+
+    // Number of times the producer lapped this consumer (overwrite mode)
+    [[nodiscard]] uint64_t overruns() const noexcept {
+        return overruns_;
+    }
+
+    // Bytes occupied in the ring by a message with the given payload size
+    [[nodiscard]] size_t record_size(size_t data_size) const noexcept {
+        return layout_.header_size + align_up(data_size, 8);
+    }
+
+    // Record header layout this ring was opened with
+    [[nodiscard]] const RecordLayout& layout() const noexcept {
+        return layout_;
+    }
+
 private:
-    // Write bytes to ring buffer (handles wrap-around)
-    inline void write_bytes(const void* src, size_t size, uint64_t offset) noexcept {
-        const size_t pos = static_cast<size_t>(offset & mask_);
-        const size_t end_pos = pos + size;
+    [[nodiscard]] inline size_t offset(uint64_t index) const noexcept {
+        return static_cast<size_t>(index & mask_);
+    }
+
+    // Check whether needed more bytes fit between write and read positions
+    [[nodiscard]] inline bool fits(uint64_t write, uint64_t read, size_t needed) const noexcept {
+        return (write - read) + needed <= size_;
+    }
+
+    [[nodiscard]] inline uint8_t* record_payload(uint64_t index) const noexcept {
+        return buffer_ + offset(index) + layout_.header_size;
+    }
+
+    // Size word of the record at index (payload size, or bytes to skip)
+    [[nodiscard]] inline uint32_t size_at(uint64_t index) const noexcept {
+        return reinterpret_cast<const uint32_t*>(buffer_ + offset(index))[1];
+    }
+
+    // Optional record fields; 0 when the framing leaves them out
+    struct RecordFields {
+        uint64_t sequence = 0;
+        uint64_t timestamp = 0;
+        uint32_t checksum = 0;
+        uint32_t type_id = 0;
+    };
 
-        if (end_pos <= size_) {
-            // No wrap-around
-            std::memcpy(buffer_ + pos, src, size);
-        } else {
-            // Wrap-around
-            const size_t first_part = size_ - pos;
-            std::memcpy(buffer_ + pos, src, first_part);
-            std::memcpy(buffer_, static_cast<const uint8_t*>(src) + first_part,
-                       size - first_part);
+    // Call fn with the channel's field set as a compile-time constant
+    // The set is fixed at open, so this one (always predicted) switch
+    // replaces a test per field per message: each case is straight-line
+    // code for one framing.
+    template<typename Fn>
+    inline decltype(auto) with_fields(Fn&& fn) const noexcept {
+        switch (layout_.fields) {
+        case 0: return fn(std::integral_constant<uint32_t, 0>{});
+        case 1: return fn(std::integral_constant<uint32_t, 1>{});
+        case 2: return fn(std::integral_constant<uint32_t, 2>{});
+        case 3: return fn(std::integral_constant<uint32_t, 3>{});
+        case 4: return fn(std::integral_constant<uint32_t, 4>{});
+        case 5: return fn(std::integral_constant<uint32_t, 5>{});
+        case 6: return fn(std::integral_constant<uint32_t, 6>{});
+        default: return fn(std::integral_constant<uint32_t, RecordLayout::ALL_FIELDS>{});
         }
     }
 
-    // Read bytes from ring buffer (handles wrap-around)
-    inline void read_bytes(void* dst, size_t size, uint64_t offset) const noexcept {
-        const size_t pos = static_cast<size_t>(offset & mask_);
-        const size_t end_pos = pos + size;
+    [[nodiscard]] inline RecordFields load_fields(uint64_t index) const noexcept {
+        const uint8_t* record = buffer_ + offset(index);
+        return with_fields([record](auto fields) {
+            constexpr RecordLayout layout = RecordLayout::for_fields(decltype(fields)::value);
+            RecordFields loaded;
+            if constexpr (layout.sequence_offset != 0) {
+                std::memcpy(&loaded.sequence, record + layout.sequence_offset, sizeof(uint64_t));
+            }
+            if constexpr (layout.timestamp_offset != 0) {
+                std::memcpy(&loaded.timestamp, record + layout.timestamp_offset, sizeof(uint64_t));
+            }
+            if constexpr (layout.checksum_offset != 0) {
+                std::memcpy(&loaded.checksum, record + layout.checksum_offset, sizeof(uint32_t));
+                std::memcpy(&loaded.type_id, record + layout.type_id_offset, sizeof(uint32_t));
+            }
+            return loaded;
+        });
+    }
+
+    inline void store_fields(uint64_t index, const RecordFields& stored) noexcept {
+        uint8_t* record = buffer_ + offset(index);
+        with_fields([record, &stored](auto fields) {
+            constexpr RecordLayout layout = RecordLayout::for_fields(decltype(fields)::value);
+            if constexpr (layout.sequence_offset != 0) {
+                std::memcpy(record + layout.sequence_offset, &stored.sequence, sizeof(uint64_t));
+            }
+            if constexpr (layout.timestamp_offset != 0) {
+                std::memcpy(record + layout.timestamp_offset, &stored.timestamp, sizeof(uint64_t));
+            }
+            if constexpr (layout.checksum_offset != 0) {
+                std::memcpy(record + layout.checksum_offset, &stored.checksum, sizeof(uint32_t));
+                std::memcpy(record + layout.type_id_offset, &stored.type_id, sizeof(uint32_t));
+            }
+        });
+    }
+
+    // This consumer's read position: read_index, or its broadcast cursor
+    [[nodiscard]] inline std::atomic<uint64_t>& read_position(SharedMemoryHeader* header) const noexcept {
+        return cursor_ ? cursor_->position : header->read_index;
+    }
+
+    // Oldest position still needed by any consumer (producer side)
+    // A broadcast channel with no consumers attached never fills up.
+    [[nodiscard]] inline uint64_t load_read_position(uint64_t current_write,
+                                                     SharedMemoryHeader* header) const noexcept {
+        if (!broadcast_) {
+            return header->read_index.load(std::memory_order_acquire);
+        }
+
+        // Order our write_index store before the scan (see attach_consumer)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
 
-        if (end_pos <= size_) {
-            // No wrap-around
-            std::memcpy(dst, buffer_ + pos, size);
-        } else {
-            // Wrap-around
-            const size_t first_part = size_ - pos;
-            std::memcpy(dst, buffer_ + pos, first_part);
-            std::memcpy(static_cast<uint8_t*>(dst) + first_part, buffer_,
-                       size - first_part);
+        uint64_t oldest = current_write;
+        for (const auto& cursor : header->cursors) {
+            if (cursor.state.load(std::memory_order_acquire) == ConsumerCursor::ACTIVE) {
+                oldest = std::min(oldest, cursor.position.load(std::memory_order_acquire));
+            }
         }
+        return oldest;
     }
 
-    // Get current timestamp in nanoseconds
-    static inline uint64_t get_timestamp_ns() noexcept {
-        return std::chrono::steady_clock::now().time_since_epoch().count();
+    // Refresh cached_read_ once the ring looks full (producer side)
+    // When the oldest broadcast cursor has not moved since the last refresh,
+    // its owner may have died: reclaim it if so, and refresh again.
+    inline void refresh_read_position(uint64_t current_write, SharedMemoryHeader* header) noexcept {
+        cached_read_ = load_read_position(current_write, header);
+        if (!broadcast_) {
+            return;
+        }
+        if (cached_read_ == stalled_read_ && cached_read_ != current_write &&
+            reclaim_dead_cursors(header, cached_read_) != 0) {
+            cached_read_ = load_read_position(current_write, header);
+        }
+        stalled_read_ = cached_read_;
+    }
+
+    // Find the next message at the read position, consuming any padding record
+    // Returns false when the buffer is empty or the record is corrupted.
+    [[nodiscard]] inline bool next_message(uint64_t& current_read,
+                                           SharedMemoryHeader* header) noexcept {
+        current_read = read_position(header).load(std::memory_order_relaxed);
+
+        // Check if data is available
+        // Only touch the producer's cache line when the cached write index
+        // says the buffer is empty.
+        if (current_read >= cached_write_) {
+            cached_write_ = header->write_index.load(std::memory_order_acquire);
+            if (current_read >= cached_write_) {
+                return false;  // Buffer empty
+            }
+        }
+
+        // Skip padding (end of the ring, or space a producer gave back)
+        uint32_t magic = magic_at(current_read);
+        while (magic == MessageHeader::PADDING) {
+            const uint64_t next = current_read + size_at(current_read);
+            publish_read(current_read, next, header);
+            current_read = next;
+            if (current_read >= cached_write_) {
+                return false;
+            }
+            magic = magic_at(current_read);
+        }
+
+        // Validate header; false if not committed yet (multi-producer) or corrupted
+        return magic == MessageHeader::MAGIC;
+    }
+
+    // Overwrite mode: make room for needed bytes at index
+    // oldest_index moves past every record the new bytes will cover, and the
+    // fence orders that store before any of them (pairs with the acquire
+    // fence in try_read_lapped). The walk is bounded by the record count of
+    // needed bytes, so it does not depend on how far behind the consumer is.
+    inline void evict(uint64_t index, size_t needed, SharedMemoryHeader* header) noexcept {
+        uint64_t oldest = header->oldest_index.load(std::memory_order_relaxed);
+        if (fits(index, oldest, needed)) {
+            return;
+        }
+
+        do {
+            const uint32_t size = size_at(oldest);
+            oldest += (magic_at(oldest) == MessageHeader::PADDING) ? size : record_size(size);
+        } while (!fits(index, oldest, needed));
+
+        header->oldest_index.store(oldest, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    // Overwrite mode try_read: validate each record against oldest_index
+    // A record is intact if it carries the sequence of its position and the
+    // producer had not evicted it by the time the copy finished.
+    [[nodiscard]] inline bool try_read_lapped(void* data, size_t& data_size,
+                                              SharedMemoryHeader* header) noexcept {
+        std::atomic<uint64_t>& position = read_position(header);
+        uint64_t current_read = position.load(std::memory_order_relaxed);
+
+        for (;;) {
+            if (current_read >= header->write_index.load(std::memory_order_acquire)) {
+                return false;  // Buffer empty
+            }
+
+            const uint64_t oldest = header->oldest_index.load(std::memory_order_acquire);
+            if (current_read < oldest) {
+                // Lapped: resync to the oldest intact record
+                ++overruns_;
+                current_read = oldest;
+                position.store(current_read, std::memory_order_release);
+                continue;
+            }
+
+            const uint32_t magic = magic_at(current_read);
+            const uint32_t size = size_at(current_read);
+
+            // The other header fields are read only from a record that fits
+            // in the ring: a short padding record at its end does not hold them
+            RecordFields fields;
+            const bool fits_ring = magic == MessageHeader::MAGIC &&
+                                   offset(current_read) + record_size(size) <= size_;
+            if (fits_ring) {
+                fields = load_fields(current_read);
+            }
+            const bool is_message = fits_ring && fields.sequence == current_read;
+
+            // Copy first, validate after
+            uint32_t checksum = 0;
+            if (is_message && size <= data_size) {
+                checksum = copy_payload(data, record_payload(current_read), size);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (current_read < header->oldest_index.load(std::memory_order_relaxed)) {
+                continue;  // Overwritten while we looked at it
+            }
+
+            if (magic == MessageHeader::PADDING) {
+                current_read += size;
+                position.store(current_read, std::memory_order_release);
+                continue;
+            }
+
+            if (!is_message) {
+                return false;  // Corrupted
+            }
+
+            if (size > data_size) {
+                data_size = size;  // Return required size
+                return false;
+            }
+
+            const bool intact = verify(fields.checksum, checksum);
+            current_read += record_size(size);
+            position.store(current_read, std::memory_order_release);
+            if (!intact) {
+                continue;  // Dropped
+            }
+
+            data_size = size;
+            last_timestamp_ = fields.timestamp;
+            last_type_id_ = fields.type_id;
+            return true;
+        }
+    }
+
+    [[nodiscard]] inline std::atomic_ref<uint32_t> magic_ref(uint64_t index) const noexcept {
+        return std::atomic_ref<uint32_t>(*reinterpret_cast<uint32_t*>(buffer_ + offset(index)));
+    }
+
+    // Load a record's magic word (pairs with the release store that commits it)
+    [[nodiscard]] inline uint32_t magic_at(uint64_t index) const noexcept {
+        return magic_ref(index).load(std::memory_order_acquire);
+    }
+
+    // Publish the pending reservation (producer side of commit)
+    inline void publish_reservation(size_t data_size, uint32_t checksum, uint32_t type_id,
+                                    SharedMemoryHeader* header) noexcept {
+        const size_t used = record_size(data_size);
+        const uint64_t timestamp = take_timestamp(timestamp_source_);
+        has_reservation_ = false;
+
+        if (multi_producer_) {
+            // Claimed space cannot shrink; the unused part becomes padding
+            const size_t slack = record_size(reserved_size_) - used;
+            if (slack != 0) {
+                write_padding(reserved_index_ + used, slack);
+            }
+            write_header(reserved_index_, data_size, timestamp, checksum, type_id);
+            notify_consumers(header);
+            return;
+        }
+
+        write_header(reserved_index_, data_size, timestamp, checksum, type_id);
+
+        // Update write index (release semantics for visibility)
+        header->write_index.store(reserved_index_ + used, std::memory_order_release);
+        notify_consumers(header);
+    }
+
+    // Wake parked consumers after a publish (ChannelFlags::BlockingWait)
+    // and signal an armed eventfd (ChannelFlags::NotifyFd). The fence orders
+    // the publish before the checks, pairing with the one a consumer makes
+    // after registering; no system call unless someone is waiting.
+    inline void notify_consumers(SharedMemoryHeader* header) noexcept {
+        if (!blocking_ && notifier_ == nullptr) {
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (blocking_ && header->data_waiters.load(std::memory_order_relaxed) != 0) {
+            wake_consumers(header);
+        }
+        // Only the producer that disarms it signals
+        if (notifier_ != nullptr && header->notify_armed.load(std::memory_order_relaxed) != 0 &&
+            header->notify_armed.exchange(0, std::memory_order_acquire) != 0) {
+            notifier_->signal(header);
+        }
+    }
+
+    // Wake producers parked for space after a release (ChannelFlags::BlockingWait)
+    inline void notify_producers(SharedMemoryHeader* header) noexcept {
+        if (!blocking_) {
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (header->space_waiters.load(std::memory_order_relaxed) != 0) {
+            wake_producers(header);
+        }
+    }
+
+    // Copy a payload, returning its CRC32C if checksums are enabled (else 0)
+    inline uint32_t copy_payload(void* dst, const void* src, size_t size) const noexcept {
+        if (checksum_) {
+            return copy_crc32c(dst, src, size);
+        }
+        std::memcpy(dst, src, size);
+        return 0;
+    }
+
+    // Check a record's stored checksum against one computed on read
+    // Always true when checksums are disabled.
+    inline bool verify(uint32_t stored, uint32_t computed) noexcept {
+        if (!checksum_ || stored == computed) {
+            return true;
+        }
+        ++checksum_mismatches_;
+        return false;
+    }
+
+    // Write a message header in place at index
+    // Only the fields in the channel's layout are written; the magic word
+    // goes last: it commits the record.
+    inline void write_header(uint64_t index, size_t data_size, uint64_t timestamp,
+                             uint32_t checksum, uint32_t type_id) noexcept {
+        auto* words = reinterpret_cast<uint32_t*>(buffer_ + offset(index));
+        words[1] = static_cast<uint32_t>(data_size);
+        store_fields(index, {index, timestamp, checksum, type_id});
+        magic_ref(index).store(MessageHeader::MAGIC, std::memory_order_release);
+    }
+
+    // Fill [index, index + skip) with a padding record
+    // Only magic and size are written, so skip may be as small as 8 bytes.
+    inline void write_padding(uint64_t index, size_t skip) noexcept {
+        auto* words = reinterpret_cast<uint32_t*>(buffer_ + offset(index));
+        words[1] = static_cast<uint32_t>(skip);
+        magic_ref(index).store(MessageHeader::PADDING, std::memory_order_release);
+    }
+
+    // Hand [from, to) back to the producers
+    // In multi-producer mode the space is zeroed first, so that a stale magic
+    // word can never be mistaken for a committed record.
+    inline void publish_read(uint64_t from, uint64_t to, SharedMemoryHeader* header) noexcept {
+        if (multi_producer_ && to != from) {
+            const size_t pos = offset(from);
+            const size_t length = static_cast<size_t>(to - from);
+            const size_t first_part = std::min(length, size_ - pos);
+            std::memset(buffer_ + pos, 0, first_part);
+            std::memset(buffer_, 0, length - first_part);
+        }
+        read_position(header).store(to, std::memory_order_release);
+        notify_producers(header);
     }
 
     uint8_t* buffer_;
     size_t size_;
     size_t mask_;
+    bool multi_producer_;
+    bool broadcast_;
+    bool overwrite_;
+    bool checksum_;
+    bool blocking_;
+    NotifySender* notifier_ = nullptr;
+    TimestampSource timestamp_source_;
+    RecordLayout layout_;
+
+    // Attached broadcast cursor (consumer side)
+    ConsumerCursor* cursor_ = nullptr;
+
+    // Last seen value of the other side's index; indices only grow, so a
+    // stale copy is always conservative
+    uint64_t cached_read_ = 0;   // Producer side
+    uint64_t cached_write_ = 0;  // Consumer side
+
+    // Oldest broadcast cursor at the last refresh (producer side)
+    uint64_t stalled_read_ = ANY_POSITION;
+
+    // Pending zero-copy reservation (producer side)
+    uint64_t reserved_index_ = 0;
+    size_t reserved_size_ = 0;
+    bool has_reservation_ = false;
+
+    // End of the message returned by try_peek (consumer side)
+    uint64_t peeked_end_ = 0;
+
+    // Timestamp and type id of the last message handed out (consumer side)
+    uint64_t last_timestamp_ = 0;
+    uint32_t last_type_id_ = 0;
+
+    // Times this consumer was lapped in overwrite mode
+    uint64_t overruns_ = 0;
+
+    // Records this consumer dropped on a checksum mismatch
+    uint64_t checksum_mismatches_ = 0;
 };
 
 } // namespace swiftchannel
@@ -2,17 +2,34 @@
 
 #include "../common/types.hpp"
 #include "../common/error.hpp"
+#include "../common/type_id.hpp"
+#include "../common/timestamp.hpp"
+#include "../common/wait.hpp"
+#include "../common/executor.hpp"
 #include "config.hpp"
 #include "channel.hpp"
 #include "message.hpp"
 #include "ring_buffer.hpp"
 
+#include <algorithm>
 #include <string>
 #include <memory>
 #include <chrono>
+#include <coroutine>
+#include <new>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <utility>
 
 namespace swiftchannel {
 
+// How send_batch handles a batch that does not fit in the ring
+enum class BatchMode {
+    Partial,        // Publish as many messages as fit
+    AllOrNothing,   // Publish the whole batch or nothing
+};
+
 // Header-only Sender API
 // Zero-allocation, inline ring buffer writes
 // No syscalls in the fast path
@@ -23,6 +40,7 @@ public:
                    const ChannelConfig& config = {})
         : channel_name_(channel_name)
         , config_(config)
+        , waiter_(config.wait_strategy, config.wait_sleep_us * 1000)
     {
         // Open or create the channel (this may allocate/map memory)
         auto result = Channel::open(channel_name, config);
@@ -32,7 +50,12 @@ public:
         // If failed, channel_ remains nullptr and sends will fail
     }
 
-    ~Sender() = default;
+    ~Sender() {
+        // Give back space claimed by a reservation that was never committed
+        if (channel_ && channel_->ring_buffer()) {
+            channel_->ring_buffer()->cancel();
+        }
+    }
 
     // Non-copyable, movable
     Sender(const Sender&) = delete;
@@ -46,15 +69,16 @@ public:
     }
 
     // Send a typed message (header-only fast path)
+    // The record is tagged with type_id_v<T> for Dispatcher.
     template<Sendable T>
     [[nodiscard]] inline Result<void> send(const T& message) noexcept {
-        return send_bytes(&message, sizeof(T));
+        return write_message(&message, sizeof(T), type_id_v<T>);
     }
 
     // Send a Message<T>
     template<Sendable T>
     [[nodiscard]] inline Result<void> send(const Message<T>& message) noexcept {
-        return send_bytes(message.raw_data(), message.size());
+        return write_message(message.raw_data(), message.size(), type_id_v<T>);
     }
 
     // Send a DynamicMessage
@@ -62,31 +86,217 @@ public:
         return send_bytes(message.data(), message.size());
     }
 
-    // Send raw bytes (the core implementation)
+    // Send raw bytes (untyped)
     [[nodiscard]] inline Result<void> send_bytes(const void* data, size_t size) noexcept {
+        return write_message(data, size, 0);
+    }
+
+    // Send a typed message, waiting while the channel is full
+    // Waits as ChannelConfig::wait_strategy says (parking needs a channel
+    // created with blocking_wait) for at most ChannelConfig::timeout_us
+    // (0 = indefinitely); returns ChannelFull if that passes first.
+    template<Sendable T>
+    [[nodiscard]] inline Result<void> send_blocking(const T& message) noexcept {
+        return send_waiting(&message, sizeof(T), config_.timeout_us * 1000, type_id_v<T>);
+    }
+
+    // Send raw bytes, waiting while the channel is full (see send_blocking)
+    [[nodiscard]] inline Result<void> send_blocking_bytes(const void* data,
+                                                          size_t size) noexcept {
+        return send_waiting(data, size, config_.timeout_us * 1000, 0);
+    }
+
+    // Send a typed message, waiting at most timeout while the channel is full
+    template<Sendable T, typename Rep, typename Period>
+    [[nodiscard]] inline Result<void> send_for(
+        const T& message, std::chrono::duration<Rep, Period> timeout) noexcept {
+        return send_within(&message, sizeof(T), timeout, type_id_v<T>);
+    }
+
+    // Send raw bytes, waiting at most timeout while the channel is full
+    template<typename Rep, typename Period>
+    [[nodiscard]] inline Result<void> send_for_bytes(
+        const void* data, size_t size, std::chrono::duration<Rep, Period> timeout) noexcept {
+        return send_within(data, size, timeout, 0);
+    }
+
+    // Result of async_send, to be co_awaited
+    class SendAwaiter {
+    public:
+        SendAwaiter(Sender& sender, const void* data, size_t size, uint32_t type_id) noexcept
+            : sender_(sender), data_(data), size_(size), type_id_(type_id) {}
+
+        bool await_ready() noexcept {
+            return attempt();
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) noexcept {
+            Executor* executor = Executor::current();
+            if (executor == nullptr) {
+                result_ = sender_.send_waiting(data_, size_, 0, type_id_);
+                return false;  // Waited in place
+            }
+
+            auto* rb = sender_.channel_->ring_buffer();
+            auto* header = sender_.channel_->header();
+            executor->suspend(handle, Readiness{&poll, this,
+                rb->blocking() ? &header->space_futex : nullptr, &header->space_waiters});
+            return true;
+        }
+
+        Result<void> await_resume() const noexcept {
+            return result_;
+        }
+
+    private:
+        // Try to send; true once done (sent, or failed for a reason other
+        // than a full channel)
+        bool attempt() noexcept {
+            if (sender_.is_ready()) {
+                seen_ = sender_.channel_->ring_buffer()->consumer_position(
+                    sender_.channel_->header());
+            }
+            result_ = sender_.write_message(data_, size_, type_id_);
+            return result_.is_ok() || result_.error() != ErrorCode::ChannelFull;
+        }
+
+        // Retry once a consumer has moved
+        static bool poll(void* self) {
+            auto* awaiter = static_cast<SendAwaiter*>(self);
+            Channel& channel = *awaiter->sender_.channel_;
+            if (channel.ring_buffer()->consumer_position(channel.header()) == awaiter->seen_) {
+                return false;
+            }
+            return awaiter->attempt();
+        }
+
+        Sender& sender_;
+        const void* data_;
+        size_t size_;
+        uint32_t type_id_;
+        uint64_t seen_ = 0;
+        Result<void> result_;
+    };
+
+    // Send a typed message from a coroutine: co_await yields Result<void>
+    // While the channel is full the awaiting task is suspended on the
+    // current Executor (see common/executor.hpp); outside one the thread
+    // waits as send_blocking does, without a timeout. message must stay
+    // alive until the co_await completes.
+    template<Sendable T>
+    [[nodiscard]] inline SendAwaiter async_send(const T& message) noexcept {
+        return SendAwaiter(*this, &message, sizeof(T), type_id_v<T>);
+    }
+
+    // Send raw bytes from a coroutine (see async_send)
+    [[nodiscard]] inline SendAwaiter async_send_bytes(const void* data, size_t size) noexcept {
+        return SendAwaiter(*this, data, size, 0);
+    }
+
+    // Send a batch of typed messages with a single publish
+    // Returns the number of messages sent; ChannelFull if none were.
+    template<Sendable T>
+    [[nodiscard]] inline Result<size_t> send_batch(std::span<const T> messages,
+                                                   BatchMode mode = BatchMode::Partial) noexcept {
+        if (sizeof(T) > config_.max_message_size) {
+            return Result<size_t>(ErrorCode::MessageTooLarge);
+        }
+
+        return write_batch(messages.size(), [&](size_t i) {
+            return std::span<const uint8_t>(
+                reinterpret_cast<const uint8_t*>(&messages[i]), sizeof(T));
+        }, mode, type_id_v<T>);
+    }
+
+    // Send a batch from any contiguous range of messages (std::vector,
+    // std::array, a plain array), without spelling out the span
+    template<std::ranges::contiguous_range Range>
+        requires std::ranges::sized_range<Range> && Sendable<std::ranges::range_value_t<Range>>
+    [[nodiscard]] inline Result<size_t> send_batch(const Range& messages,
+                                                   BatchMode mode = BatchMode::Partial) noexcept {
+        using T = std::ranges::range_value_t<Range>;
+        return send_batch(std::span<const T>(std::ranges::data(messages), std::ranges::size(messages)),
+                          mode);
+    }
+
+    // Send a batch of raw messages gathered from separate buffers
+    // Returns the number of messages sent; ChannelFull if none were.
+    [[nodiscard]] inline Result<size_t> send_batch_bytes(
+        std::span<const std::span<const uint8_t>> messages,
+        BatchMode mode = BatchMode::Partial) noexcept {
+        for (const auto& message : messages) {
+            if (message.size() > config_.max_message_size) {
+                return Result<size_t>(ErrorCode::MessageTooLarge);
+            }
+        }
+
+        return write_batch(messages.size(), [&](size_t i) {
+            return messages[i];
+        }, mode, 0);
+    }
+
+    // Reserve space for a message of up to max_size bytes (zero-copy)
+    // The returned span points directly into shared memory; write the payload
+    // there and publish it with commit(). Only one reservation may be pending;
+    // reserving again abandons the previous one.
+    [[nodiscard]] inline Result<std::span<uint8_t>> reserve(size_t max_size) noexcept {
+        if (!is_ready()) {
+            return Result<std::span<uint8_t>>(ErrorCode::ChannelClosed);
+        }
+
+        if (max_size > config_.max_message_size) {
+            return Result<std::span<uint8_t>>(ErrorCode::MessageTooLarge);
+        }
+
+        std::span<uint8_t> payload;
+        if (!channel_->ring_buffer()->try_reserve(max_size, payload, channel_->header())) {
+            return Result<std::span<uint8_t>>(ErrorCode::ChannelFull);
+        }
+
+        return Result<std::span<uint8_t>>(std::move(payload));
+    }
+
+    // Publish the pending reservation with its final payload size
+    // type_id tags the message for Dispatcher (0 = untyped).
+    [[nodiscard]] inline Result<void> commit(size_t size, uint32_t type_id = 0) noexcept {
         if (!is_ready()) {
             return Result<void>(ErrorCode::ChannelClosed);
         }
 
-        if (size > config_.max_message_size) {
+        auto* rb = channel_->ring_buffer();
+        if (!rb->has_reservation()) {
+            return Result<void>(ErrorCode::InvalidOperation);
+        }
+
+        if (size > rb->reserved_size()) {
             return Result<void>(ErrorCode::MessageTooLarge);
         }
 
-        // Fast path: try to write directly to ring buffer
-        auto* rb = channel_->ring_buffer();
-        auto* header = channel_->header();
+        rb->commit(size, channel_->header(), type_id);
+        return Result<void>();
+    }
 
-        if (rb->try_write(data, size, header)) {
-            return Result<void>();  // Success
+    // Publish the pending reservation using the full reserved size
+    [[nodiscard]] inline Result<void> commit() noexcept {
+        if (!is_ready() || !channel_->ring_buffer()->has_reservation()) {
+            return Result<void>(ErrorCode::InvalidOperation);
         }
+        return commit(channel_->ring_buffer()->reserved_size());
+    }
 
-        // Buffer full
-        if (config_.overwrite_on_full) {
-            // TODO: Implement overwrite logic
-            return Result<void>(ErrorCode::ChannelFull);
+    // Construct a message in place inside the ring and publish it
+    template<Sendable T, typename... Args>
+    [[nodiscard]] inline Result<void> emplace(Args&&... args)
+        noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+        static_assert(alignof(T) <= 8, "Ring buffer payloads are 8-byte aligned");
+
+        auto slot = reserve(sizeof(T));
+        if (slot.is_error()) {
+            return Result<void>(slot.error());
         }
 
-        return Result<void>(ErrorCode::ChannelFull);
+        ::new (static_cast<void*>(slot.value().data())) T(std::forward<Args>(args)...);
+        return commit(sizeof(T), type_id_v<T>);
     }
 
     // Try to send without blocking (returns false if would block)
@@ -108,15 +318,140 @@ public:
         return channel_name_;
     }
 
+    // Backpressure seen by send_blocking and send_for
+    struct Stats {
+        uint64_t stalls;        // Sends that found the channel full and waited
+        uint64_t stall_ns;      // Total time spent waiting for space
+        uint64_t max_stall_ns;  // Longest single wait
+        uint64_t timeouts;      // Waits that gave up with ChannelFull
+    };
+
+    [[nodiscard]] Stats get_stats() const noexcept {
+        return stats_;
+    }
+
     // Get configuration
     [[nodiscard]] const ChannelConfig& config() const noexcept {
         return config_;
     }
 
 private:
+    // Send one message tagged with type_id (the core implementation)
+    [[nodiscard]] inline Result<void> write_message(const void* data, size_t size,
+                                                    uint32_t type_id) noexcept {
+        if (!is_ready()) {
+            return Result<void>(ErrorCode::ChannelClosed);
+        }
+
+        if (size > config_.max_message_size) {
+            return Result<void>(ErrorCode::MessageTooLarge);
+        }
+
+        // Fast path: try to write directly to ring buffer
+        // (an overwrite channel evicts the oldest messages instead of filling up)
+        auto* rb = channel_->ring_buffer();
+        auto* header = channel_->header();
+
+        if (rb->try_write(data, size, header, type_id)) {
+            return Result<void>();  // Success
+        }
+
+        return Result<void>(ErrorCode::ChannelFull);
+    }
+
+
+    template<typename PayloadAt>
+    [[nodiscard]] inline Result<size_t> write_batch(size_t count, PayloadAt&& payload_at,
+                                                    BatchMode mode, uint32_t type_id) noexcept {
+        if (!is_ready()) {
+            return Result<size_t>(ErrorCode::ChannelClosed);
+        }
+
+        if (count == 0) {
+            return Result<size_t>(size_t{0});
+        }
+
+        const size_t written = channel_->ring_buffer()->try_write_batch(
+            count, payload_at, channel_->header(), mode == BatchMode::AllOrNothing, type_id);
+
+        if (written == 0) {
+            return Result<size_t>(ErrorCode::ChannelFull);
+        }
+
+        return Result<size_t>(size_t{written});
+    }
+
+    // write_message, waiting at most timeout (a single try if not positive)
+    template<typename Rep, typename Period>
+    [[nodiscard]] inline Result<void> send_within(const void* data, size_t size,
+                                                  std::chrono::duration<Rep, Period> timeout,
+                                                  uint32_t type_id) noexcept {
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+        if (ns <= 0) {
+            return write_message(data, size, type_id);
+        }
+        return send_waiting(data, size, static_cast<uint64_t>(ns), type_id);
+    }
+
+    // write_message, then wait for consumers to free space and retry, for
+    // at most timeout_ns (0 = no limit)
+    // Each round waits for the consumer position to move: a bounded spin,
+    // then a futex park on BlockingWait channels (a yield on others).
+    [[nodiscard]] inline Result<void> send_waiting(const void* data, size_t size,
+                                                   uint64_t timeout_ns,
+                                                   uint32_t type_id) noexcept {
+        auto result = write_message(data, size, type_id);
+        if (result.is_ok() || result.error() != ErrorCode::ChannelFull) {
+            return result;
+        }
+
+        auto* rb = channel_->ring_buffer();
+        auto* header = channel_->header();
+        const uint64_t start = steady_now_ns();
+
+        for (;;) {
+            // Read before the retry, so a release right after it is not missed
+            const uint64_t seen = rb->consumer_position(header);
+            if (rb->try_write(data, size, header, type_id)) {
+                waiter_.progress();
+                record_stall(steady_now_ns() - start);
+                return Result<void>();
+            }
+
+            uint64_t remaining = 0;
+            if (timeout_ns != 0) {
+                const uint64_t waited = steady_now_ns() - start;
+                if (waited >= timeout_ns) {
+                    record_stall(waited);
+                    ++stats_.timeouts;
+                    return Result<void>(ErrorCode::ChannelFull);
+                }
+                remaining = timeout_ns - waited;
+            }
+
+            waiter_.idle(remaining, rb->broadcasts() ? nullptr : &header->read_index,
+                [&] { return rb->consumer_position(header) != seen; },
+                [&](uint64_t park_ns) {
+                    if (rb->blocking()) {
+                        rb->wait_for_space(header, seen, park_ns, [] { return false; });
+                    } else {
+                        std::this_thread::yield();
+                    }
+                });
+        }
+    }
+
+    inline void record_stall(uint64_t ns) noexcept {
+        ++stats_.stalls;
+        stats_.stall_ns += ns;
+        stats_.max_stall_ns = std::max(stats_.max_stall_ns, ns);
+    }
+
     std::string channel_name_;
     ChannelConfig config_;
     std::unique_ptr<Channel> channel_;
+    Waiter waiter_;
+    Stats stats_{};
 };
 
 } // namespace swiftchannel
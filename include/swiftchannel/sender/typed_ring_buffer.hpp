@@ -0,0 +1,160 @@
+#pragma once
+
+#include "../common/types.hpp"
+#include "../common/alignment.hpp"
+#include "config.hpp"
+#include "message.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <span>
+
+namespace swiftchannel {
+
+// Lock-free SPSC ring of fixed-size slots for a single message type
+// The ring area is a plain array of Capacity values of T: no per-message
+// header, magic word or padding, and the index math is a compile-time mask.
+// write_index and read_index count slots instead of bytes.
+//
+// Lives in the same shared memory layout as RingBuffer (header followed by
+// the ring); the header's slot_size records sizeof(T) so that both sides
+// agree on the layout.
+template<Sendable T, size_t Capacity = 4096>
+class TypedRingBuffer {
+    static_assert(is_power_of_two(Capacity), "Capacity must be a power of 2");
+    static_assert(alignof(T) <= CACHE_LINE_SIZE, "T must not be over-aligned");
+
+public:
+    static constexpr size_t capacity = Capacity;
+
+    // Bytes to reserve for the ring area (a power of 2, as channels require)
+    static constexpr size_t ring_size = std::bit_ceil(Capacity * sizeof(T));
+
+    // Channel settings for a typed channel built on top of base
+    [[nodiscard]] static constexpr ChannelConfig channel_config(ChannelConfig base = {}) noexcept {
+        base.ring_buffer_size = ring_size;
+        base.max_message_size = sizeof(T);
+        base.slot_size = static_cast<uint32_t>(sizeof(T));
+        return base;
+    }
+
+    TypedRingBuffer() = delete;
+    explicit TypedRingBuffer(void* memory) noexcept
+        : slots_(static_cast<T*>(memory))
+    {
+        assert(is_aligned(reinterpret_cast<uintptr_t>(memory), CACHE_LINE_SIZE));
+    }
+
+    // Try to write one value (non-blocking)
+    [[nodiscard]] inline bool try_write(const T& value, SharedMemoryHeader* header) noexcept {
+        const uint64_t current_write = header->write_index.load(std::memory_order_relaxed);
+
+        // Only touch the consumer's cache line when the cached read index
+        // says the ring is full
+        if (current_write - cached_read_ >= Capacity) {
+            cached_read_ = header->read_index.load(std::memory_order_acquire);
+            if (current_write - cached_read_ >= Capacity) {
+                return false;  // Ring full
+            }
+        }
+
+        std::memcpy(&slots_[current_write & MASK], &value, sizeof(T));
+        header->write_index.store(current_write + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Write as many values as fit and publish them with a single store
+    // With all_or_nothing, nothing is written unless every value fits.
+    // Returns the number written.
+    [[nodiscard]] inline size_t try_write_batch(std::span<const T> values,
+                                                SharedMemoryHeader* header,
+                                                bool all_or_nothing = false) noexcept {
+        const uint64_t current_write = header->write_index.load(std::memory_order_relaxed);
+
+        // Refresh the cached read index at most once per batch
+        if (current_write - cached_read_ + values.size() > Capacity) {
+            cached_read_ = header->read_index.load(std::memory_order_acquire);
+        }
+
+        const size_t free_slots = Capacity - static_cast<size_t>(current_write - cached_read_);
+        const size_t count = std::min(free_slots, values.size());
+        if (count == 0 || (all_or_nothing && count < values.size())) {
+            return 0;
+        }
+
+        // At most two contiguous runs: up to the end of the array, then from 0
+        const size_t first = static_cast<size_t>(current_write & MASK);
+        const size_t first_part = std::min(count, Capacity - first);
+        std::memcpy(&slots_[first], values.data(), first_part * sizeof(T));
+        std::memcpy(&slots_[0], values.data() + first_part, (count - first_part) * sizeof(T));
+
+        header->write_index.store(current_write + count, std::memory_order_release);
+        return count;
+    }
+
+    // Try to read one value (non-blocking)
+    [[nodiscard]] inline bool try_read(T& value, SharedMemoryHeader* header) noexcept {
+        const uint64_t current_read = header->read_index.load(std::memory_order_relaxed);
+
+        // Only touch the producer's cache line when the cached write index
+        // says the ring is empty
+        if (current_read >= cached_write_) {
+            cached_write_ = header->write_index.load(std::memory_order_acquire);
+            if (current_read >= cached_write_) {
+                return false;  // Ring empty
+            }
+        }
+
+        std::memcpy(&value, &slots_[current_read & MASK], sizeof(T));
+        header->read_index.store(current_read + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Hand up to max_values to fn(const T&) in place, then publish read_index once
+    // The references point into the ring and are only valid during the call.
+    // Returns the number of values consumed.
+    template<typename Fn>
+    inline size_t read_batch(size_t max_values, Fn&& fn, SharedMemoryHeader* header) {
+        const uint64_t current_read = header->read_index.load(std::memory_order_relaxed);
+        cached_write_ = header->write_index.load(std::memory_order_acquire);
+
+        const size_t count = std::min(max_values, static_cast<size_t>(cached_write_ - current_read));
+        for (size_t i = 0; i < count; ++i) {
+            fn(static_cast<const T&>(slots_[(current_read + i) & MASK]));
+        }
+
+        if (count != 0) {
+            header->read_index.store(current_read + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    // Get number of values waiting to be read
+    [[nodiscard]] inline size_t available_read(SharedMemoryHeader* header) const noexcept {
+        const uint64_t current_read = header->read_index.load(std::memory_order_relaxed);
+        const uint64_t current_write = header->write_index.load(std::memory_order_acquire);
+        return static_cast<size_t>(current_write - current_read);
+    }
+
+    // Get number of free slots
+    [[nodiscard]] inline size_t available_write(SharedMemoryHeader* header) const noexcept {
+        const uint64_t current_write = header->write_index.load(std::memory_order_relaxed);
+        const uint64_t current_read = header->read_index.load(std::memory_order_acquire);
+        return Capacity - static_cast<size_t>(current_write - current_read);
+    }
+
+private:
+    static constexpr uint64_t MASK = Capacity - 1;
+
+    T* slots_;
+
+    // Last seen value of the other side's index; indices only grow, so a
+    // stale copy is always conservative
+    uint64_t cached_read_ = 0;   // Producer side
+    uint64_t cached_write_ = 0;  // Consumer side
+};
+
+} // namespace swiftchannel
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "../common/types.hpp"
+#include "../common/error.hpp"
+#include "config.hpp"
+#include "channel.hpp"
+#include "message.hpp"
+#include "sender.hpp"
+#include "typed_ring_buffer.hpp"
+
+#include <string>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace swiftchannel {
+
+// Header-only sender for a channel that carries a single message type
+// Values go into fixed-size slots (see TypedRingBuffer), so there is no
+// per-message header to fill in. Pair with TypedReceiver<T, Capacity>.
+template<Sendable T, size_t Capacity = 4096>
+class TypedSender {
+public:
+    using Ring = TypedRingBuffer<T, Capacity>;
+
+    // Create a sender for a named typed channel
+    // The ring size and slot size in config are derived from T and Capacity.
+    explicit TypedSender(const std::string& channel_name,
+                         const ChannelConfig& config = {})
+        : channel_name_(channel_name)
+        , config_(Ring::channel_config(config))
+    {
+        auto result = Channel::open(channel_name, config_);
+        if (result.is_ok()) {
+            channel_ = std::make_unique<Channel>(std::move(result.value()));
+            ring_ = std::make_unique<Ring>(channel_->ring_memory());
+        }
+        // If failed, channel_ remains nullptr and sends will fail
+    }
+
+    // Non-copyable, movable
+    TypedSender(const TypedSender&) = delete;
+    TypedSender& operator=(const TypedSender&) = delete;
+    TypedSender(TypedSender&&) noexcept = default;
+    TypedSender& operator=(TypedSender&&) noexcept = default;
+
+    // Check if sender is ready
+    [[nodiscard]] bool is_ready() const noexcept {
+        return channel_ && channel_->is_open();
+    }
+
+    // Send one value
+    [[nodiscard]] inline Result<void> send(const T& value) noexcept {
+        if (!is_ready()) {
+            return Result<void>(ErrorCode::ChannelClosed);
+        }
+
+        if (ring_->try_write(value, channel_->header())) {
+            return Result<void>();
+        }
+
+        return Result<void>(ErrorCode::ChannelFull);
+    }
+
+    // Send a batch of values with a single publish
+    // Returns the number of values sent; ChannelFull if none were.
+    [[nodiscard]] inline Result<size_t> send_batch(std::span<const T> values,
+                                                   BatchMode mode = BatchMode::Partial) noexcept {
+        if (!is_ready()) {
+            return Result<size_t>(ErrorCode::ChannelClosed);
+        }
+
+        if (values.empty()) {
+            return Result<size_t>(size_t{0});
+        }
+
+        const size_t written = ring_->try_write_batch(values, channel_->header(),
+                                                      mode == BatchMode::AllOrNothing);
+        if (written == 0) {
+            return Result<size_t>(ErrorCode::ChannelFull);
+        }
+
+        return Result<size_t>(size_t{written});
+    }
+
+    // Try to send without blocking (returns false if would block)
+    [[nodiscard]] inline bool try_send(const T& value) noexcept {
+        return send(value).is_ok();
+    }
+
+    // Get number of free slots in the channel
+    [[nodiscard]] size_t available_slots() const noexcept {
+        if (!is_ready()) {
+            return 0;
+        }
+        return ring_->available_write(channel_->header());
+    }
+
+    // Get channel name
+    [[nodiscard]] const std::string& channel_name() const noexcept {
+        return channel_name_;
+    }
+
+    // Get configuration
+    [[nodiscard]] const ChannelConfig& config() const noexcept {
+        return config_;
+    }
+
+private:
+    std::string channel_name_;
+    ChannelConfig config_;
+    std::unique_ptr<Channel> channel_;
+    std::unique_ptr<Ring> ring_;
+};
+
+} // namespace swiftchannel
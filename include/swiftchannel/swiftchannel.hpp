@@ -9,6 +9,8 @@
 #include "sender/channel.hpp"
 #include "sender/message.hpp"
 #include "sender/ring_buffer.hpp"
+#include "sender/typed_ring_buffer.hpp"
+#include "sender/typed_sender.hpp"
 #include "sender/config.hpp"
 
 // Main umbrella header for SwiftChannel
@@ -1,7 +1,10 @@
 #include "handshake.hpp"
 #include "swiftchannel/common/version.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <cstring>
+#include <thread>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -12,22 +15,66 @@
 
 namespace swiftchannel {
 
+namespace {
+
+// How long a peer waits for the opener that claimed the header
+constexpr auto PUBLISH_TIMEOUT = std::chrono::seconds(1);
+
+std::atomic_ref<uint32_t> magic_of(SharedMemoryHeader* header) {
+    return std::atomic_ref<uint32_t>(header->magic);
+}
+
+} // namespace
+
+bool Handshake::claim_header(SharedMemoryHeader* header) {
+    // Anything but a published or claimed header (a new segment's zeros,
+    // or leftovers of an older protocol) is up for grabs
+    uint32_t magic = magic_of(header).load(std::memory_order_acquire);
+    return magic != SharedMemoryHeader::MAGIC && magic != SharedMemoryHeader::INITIALIZING &&
+           magic_of(header).compare_exchange_strong(magic, SharedMemoryHeader::INITIALIZING,
+                                                    std::memory_order_acquire);
+}
+
 void Handshake::initialize_header(SharedMemoryHeader* header,
                                   size_t ring_buffer_size,
-                                  uint64_t flags) {
-    std::memset(header, 0, sizeof(SharedMemoryHeader));
+                                  uint64_t flags,
+                                  uint32_t slot_size) {
+    // The magic word is the claim; it stays until publish_header
+    std::memset(reinterpret_cast<uint8_t*>(header) + sizeof(header->magic), 0,
+                sizeof(SharedMemoryHeader) - sizeof(header->magic));
 
-    header->magic = SharedMemoryHeader::MAGIC;
     header->version = PROTOCOL_VERSION.as_uint32();
     header->ring_buffer_size = ring_buffer_size;
     header->write_index.store(0, std::memory_order_release);
+    header->oldest_index.store(0, std::memory_order_release);
     header->read_index.store(0, std::memory_order_release);
     header->flags = flags;
+    header->slot_size = slot_size;
+
+    header->sender_pid = process_id();
+}
+
+void Handshake::publish_header(SharedMemoryHeader* header) {
+    magic_of(header).store(SharedMemoryHeader::MAGIC, std::memory_order_release);
+}
+
+Result<void> Handshake::wait_published(const SharedMemoryHeader* header) {
+    auto* magic = const_cast<SharedMemoryHeader*>(header);
+    const auto deadline = std::chrono::steady_clock::now() + PUBLISH_TIMEOUT;
+    while (magic_of(magic).load(std::memory_order_acquire) != SharedMemoryHeader::MAGIC) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return Result<void>(ErrorCode::ResourceBusy);
+        }
+        std::this_thread::yield();
+    }
+    return Result<void>();
+}
 
+uint32_t Handshake::process_id() {
 #ifdef _WIN32
-    header->sender_pid = GetCurrentProcessId();
+    return static_cast<uint32_t>(GetCurrentProcessId());
 #else
-    header->sender_pid = getpid();
+    return static_cast<uint32_t>(getpid());
 #endif
 }
 
@@ -63,11 +110,7 @@ Result<void> Handshake::receiver_handshake(SharedMemoryHeader* header) {
     }
 
     // Set receiver PID
-#ifdef _WIN32
-    header->receiver_pid = GetCurrentProcessId();
-#else
-    header->receiver_pid = getpid();
-#endif
+    header->receiver_pid = process_id();
 
     return Result<void>();
 }
@@ -92,6 +135,11 @@ Result<void> Handshake::validate_header(const SharedMemoryHeader* header) {
         return Result<void>(ErrorCode::VersionMismatch);
     }
 
+    // Refuse features this side does not know (they may change the records)
+    if ((header->flags & ~KNOWN_CHANNEL_FLAGS) != 0) {
+        return Result<void>(ErrorCode::IncompatibleProtocol);
+    }
+
     // Validate ring buffer size (must be power of 2)
     if (header->ring_buffer_size == 0 ||
         (header->ring_buffer_size & (header->ring_buffer_size - 1)) != 0) {
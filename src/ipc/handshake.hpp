@@ -17,10 +17,28 @@ public:
     // Validate shared memory header
     static Result<void> validate_header(const SharedMemoryHeader* header);
 
-    // Initialize header (first time)
+    // Current process ID (recorded in the header and broadcast cursors)
+    static uint32_t process_id();
+
+    // Claim a new channel's header for initialization
+    // Exactly one opener gets true; it must initialize_header() and then
+    // publish_header(). Everyone else waits with wait_published().
+    static bool claim_header(SharedMemoryHeader* header);
+
+    // Initialize header (first time, after claim_header)
+    // Everything but the magic word is written; peers keep waiting.
     static void initialize_header(SharedMemoryHeader* header,
                                   size_t ring_buffer_size,
-                                  uint64_t flags);
+                                  uint64_t flags,
+                                  uint32_t slot_size = 0);
+
+    // Let waiting peers in: stores the magic word last, with release
+    static void publish_header(SharedMemoryHeader* header);
+
+    // Wait until the claiming opener has published the header
+    // Fails with ResourceBusy if that takes longer than a second: the
+    // opener died half way, and the channel must be removed.
+    static Result<void> wait_published(const SharedMemoryHeader* header);
 };
 
 } // namespace swiftchannel
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "swiftchannel/common/types.hpp"
+#include "swiftchannel/common/error.hpp"
+
+#include <string>
+
+namespace swiftchannel {
+
+// Receiver end of ChannelFlags::NotifyFd (see sender/notify.hpp)
+// Owns the eventfd, the socket producers fetch it from, and an epoll set
+// over both; handle() is the epoll fd, readable when either one is.
+class NotifyListener {
+public:
+    NotifyListener() = default;
+    ~NotifyListener();
+
+    NotifyListener(const NotifyListener&) = delete;
+    NotifyListener& operator=(const NotifyListener&) = delete;
+
+    // Create the eventfd and listen on the channel's socket
+    // Fails with ResourceBusy if another receiver already listens.
+    [[nodiscard]] Result<void> open(const std::string& channel_name);
+
+    // Stop listening and close every fd
+    void close() noexcept;
+
+    [[nodiscard]] bool is_open() const noexcept {
+        return epoll_fd_ >= 0;
+    }
+
+    // Pollable handle for event loops (-1 until opened)
+    [[nodiscard]] int handle() const noexcept {
+        return epoll_fd_;
+    }
+
+    // Hand the eventfd to every producer (of our user) waiting on the
+    // socket and reset its counter, so handle() stops being readable
+    // Costs one epoll_wait when neither is pending.
+    void serve() noexcept;
+
+    // Make handle() readable
+    void signal() noexcept;
+
+private:
+    int event_fd_ = -1;
+    int listen_fd_ = -1;
+    int epoll_fd_ = -1;
+};
+
+} // namespace swiftchannel
@@ -20,6 +20,7 @@ SharedMemory::SharedMemory(SharedMemory&& other) noexcept
     , data_(other.data_)
     , size_(other.size_)
     , platform_handle_(other.platform_handle_)
+    , huge_pages_(other.huge_pages_)
 {
     other.data_ = nullptr;
     other.size_ = 0;
@@ -34,6 +35,7 @@ SharedMemory& SharedMemory::operator=(SharedMemory&& other) noexcept {
         data_ = other.data_;
         size_ = other.size_;
         platform_handle_ = other.platform_handle_;
+        huge_pages_ = other.huge_pages_;
 
         other.data_ = nullptr;
         other.size_ = 0;
@@ -42,6 +44,16 @@ SharedMemory& SharedMemory::operator=(SharedMemory&& other) noexcept {
     return *this;
 }
 
+void* SharedMemory::release() noexcept {
+    void* handle = platform_handle_;
+
+    data_ = nullptr;
+    size_ = 0;
+    platform_handle_ = nullptr;
+
+    return handle;
+}
+
 // Platform-specific implementations in platform/windows/shm_win.cpp and platform/posix/shm_posix.cpp
 
 } // namespace swiftchannel
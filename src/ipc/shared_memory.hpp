@@ -9,6 +9,15 @@
 
 namespace swiftchannel {
 
+// How a mapping is backed and faulted in (see ChannelConfig)
+struct MappingOptions {
+    bool huge_pages = false;  // hugetlbfs, else transparent huge pages
+    bool prefault = false;    // Fault every page in before returning
+    bool lock = false;        // Keep the pages resident (mlock)
+    NumaPolicy numa_policy = NumaPolicy::Default;  // ConsumerNode is ignored
+    int numa_node = 0;
+};
+
 // Shared memory abstraction
 class SharedMemory {
 public:
@@ -22,10 +31,13 @@ public:
     SharedMemory& operator=(SharedMemory&&) noexcept;
 
     // Create or open shared memory
+    // size() may come out larger than requested: huge page mappings are
+    // rounded up to a whole number of pages.
     [[nodiscard]] static Result<SharedMemory> create_or_open(
         const std::string& name,
         size_t size,
-        bool create);
+        bool create,
+        const MappingOptions& options = {});
 
     // Get pointer to mapped memory
     [[nodiscard]] void* data() noexcept { return data_; }
@@ -40,9 +52,16 @@ public:
     // Check if valid
     [[nodiscard]] bool is_valid() const noexcept { return data_ != nullptr; }
 
+    // Check whether the mapping is backed by hugetlbfs pages
+    [[nodiscard]] bool huge_pages() const noexcept { return huge_pages_; }
+
     // Close/unmap
     void close();
 
+    // Give up ownership of the mapping; the caller becomes responsible for
+    // unmapping data() and closing the returned platform handle
+    [[nodiscard]] void* release() noexcept;
+
 private:
     SharedMemory(std::string name, void* data, size_t size, void* handle);
 
@@ -50,6 +69,7 @@ private:
     void* data_ = nullptr;
     size_t size_ = 0;
     void* platform_handle_ = nullptr;  // HANDLE on Windows, int on POSIX
+    bool huge_pages_ = false;
 };
 
 } // namespace swiftchannel
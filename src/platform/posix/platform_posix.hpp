@@ -1,6 +1,7 @@
 #pragma once
 
 #include "swiftchannel/common/types.hpp"
+#include "swiftchannel/common/error.hpp"
 
 #ifndef _WIN32
 
@@ -15,6 +16,9 @@ public:
     // Convert channel name to POSIX shared memory name
     static std::string to_shared_memory_name(const std::string& channel_name);
 
+    // Path of the channel's file on the hugetlbfs mount
+    static std::string to_huge_page_path(const std::string& channel_name);
+
     // Get error code from errno
     static ErrorCode get_last_error();
 
@@ -6,14 +6,21 @@
 #include "../../ipc/handshake.hpp"
 #include "swiftchannel/sender/channel.hpp"
 #include "swiftchannel/common/alignment.hpp"
+#include "swiftchannel/common/numa.hpp"
 
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <atomic>
 #include <cerrno>
 #include <cstring>
 
+#if defined(__linux__)
+#include <linux/magic.h>
+#include <sys/vfs.h>
+#endif
+
 namespace swiftchannel::platform {
 
 std::string PlatformPosix::to_shared_memory_name(const std::string& channel_name) {
@@ -21,6 +28,10 @@ std::string PlatformPosix::to_shared_memory_name(const std::string& channel_name
     return "/swiftchannel_" + channel_name;
 }
 
+std::string PlatformPosix::to_huge_page_path(const std::string& channel_name) {
+    return "/dev/hugepages" + to_shared_memory_name(channel_name);
+}
+
 ErrorCode PlatformPosix::get_last_error() {
     switch (errno) {
         case 0:
@@ -35,7 +46,10 @@ ErrorCode PlatformPosix::get_last_error() {
         case ENOMEM:
             return ErrorCode::OutOfMemory;
         case EBUSY:
+        case EADDRINUSE:
             return ErrorCode::ResourceBusy;
+        case ENAMETOOLONG:
+            return ErrorCode::InvalidChannelName;
         default:
             return ErrorCode::SystemError;
     }
@@ -49,51 +63,210 @@ uint32_t PlatformPosix::get_process_id() {
 
 namespace swiftchannel {
 
+namespace {
+
+// Huge page size of the filesystem behind fd (0 unless it is hugetlbfs)
+size_t huge_page_size(int fd) {
+#if defined(__linux__)
+    struct statfs info;
+    if (::fstatfs(fd, &info) == 0 && info.f_type == HUGETLBFS_MAGIC) {
+        return static_cast<size_t>(info.f_bsize);
+    }
+#else
+    (void)fd;
+#endif
+    return 0;
+}
+
+// Whether the channel already lives in POSIX shared memory
+bool shm_exists(const std::string& name) {
+    const std::string shm_name = platform::PlatformPosix::to_shared_memory_name(name);
+    const int fd = ::shm_open(shm_name.c_str(), O_RDWR, 0);
+    if (fd == -1) {
+        return false;
+    }
+    ::close(fd);
+    return true;
+}
+
+// Whether fd's file still has a name (its creator did not give up on it)
+bool is_linked(int fd) {
+    struct stat info;
+    return ::fstat(fd, &info) == 0 && info.st_nlink > 0;
+}
+
+// Wait up to 100 ms for the creator of an existing file to size it
+// Fails with EBUSY if it never does.
+bool wait_for_size(int fd, size_t size) {
+    for (int attempt = 0; attempt < 100; ++attempt) {
+        struct stat info;
+        if (::fstat(fd, &info) == -1) {
+            return false;
+        }
+        if (static_cast<size_t>(info.st_size) >= size) {
+            return true;
+        }
+        ::usleep(1000);
+    }
+    errno = EBUSY;
+    return false;
+}
+
+// Map the channel's hugetlbfs file, creating it if asked
+// Returns MAP_FAILED (and leaves fd at -1) when the channel belongs in
+// POSIX shm instead: there is no usable mount, no file and nothing to
+// create, the channel already exists in POSIX shm, or no huge pages are
+// free; a file created here is removed again so that the peer does not
+// find it. found is set when the file exists but cannot be mapped:
+// falling back then would split the channel in two, so it is an error
+// (errno says which).
+void* map_huge_pages(const std::string& name, size_t& size, bool create, int& fd, bool& found) {
+    const std::string path = platform::PlatformPosix::to_huge_page_path(name);
+
+    found = false;
+    bool created = false;
+    fd = ::open(path.c_str(), O_RDWR);
+    if (fd == -1 && create && !shm_exists(name)) {
+        fd = ::open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+        created = fd != -1;
+        if (fd == -1 && errno == EEXIST) {
+            fd = ::open(path.c_str(), O_RDWR);  // Another creator got there first
+        }
+    }
+    if (fd == -1) {
+        return MAP_FAILED;
+    }
+
+    void* data = MAP_FAILED;
+    const size_t page = huge_page_size(fd);
+    if (page != 0) {
+        const size_t rounded = align_up(size, page);
+        if (created ? ::ftruncate(fd, static_cast<off_t>(rounded)) == 0
+                    : wait_for_size(fd, rounded)) {
+            // Fails here, not on first touch, when the pool is too small
+            data = ::mmap(nullptr, rounded, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            size = rounded;
+        }
+        found = data == MAP_FAILED && !created && is_linked(fd);
+    }
+
+    if (data == MAP_FAILED) {
+        const int error = errno;
+        if (created) {
+            ::unlink(path.c_str());
+        }
+        ::close(fd);
+        fd = -1;
+        errno = error;
+    }
+    return data;
+}
+
+// Fault every page of [data, data + size) in, writable
+void prefault(void* data, size_t size) {
+#if defined(MADV_POPULATE_WRITE)
+    if (::madvise(data, size, MADV_POPULATE_WRITE) == 0) {
+        return;
+    }
+#endif
+    // Atomic no-op writes: the peer may already be using the memory
+    const auto page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    auto* bytes = static_cast<uint8_t*>(data);
+    for (size_t offset = 0; offset < size; offset += page) {
+        std::atomic_ref<uint8_t>(bytes[offset]).fetch_add(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace
+
 // POSIX implementation of SharedMemory::create_or_open
+// A channel that already lives on hugetlbfs is opened from there whatever
+// the options say, so both sides always map the same memory.
 Result<SharedMemory> SharedMemory::create_or_open(
     const std::string& name,
     size_t size,
-    bool create)
+    bool create,
+    const MappingOptions& options)
 {
-    std::string shm_name = platform::PlatformPosix::to_shared_memory_name(name);
-
     int shm_fd = -1;
+    bool huge_found = false;
+    void* data = map_huge_pages(name, size, create && options.huge_pages, shm_fd, huge_found);
+    const bool huge = data != MAP_FAILED;
+    if (huge_found) {
+        return Result<SharedMemory>(platform::PlatformPosix::get_last_error());
+    }
+
+    if (!huge) {
+        std::string shm_name = platform::PlatformPosix::to_shared_memory_name(name);
 
-    if (create) {
-        // Create new shared memory
-        shm_fd = ::shm_open(shm_name.c_str(), O_CREAT | O_RDWR, 0666);
+        if (create) {
+            // Create new shared memory
+            shm_fd = ::shm_open(shm_name.c_str(), O_CREAT | O_RDWR, 0666);
 
-        if (shm_fd == -1) {
-            return Result<SharedMemory>(platform::PlatformPosix::get_last_error());
+            if (shm_fd == -1) {
+                return Result<SharedMemory>(platform::PlatformPosix::get_last_error());
+            }
+
+            // Set size; never shrink a channel someone else created (its
+            // owner would fault), a size mismatch is refused on attach
+            struct stat info;
+            if (::fstat(shm_fd, &info) == -1 ||
+                (static_cast<size_t>(info.st_size) < size &&
+                 ::ftruncate(shm_fd, static_cast<off_t>(size)) == -1)) {
+                ErrorCode error = platform::PlatformPosix::get_last_error();
+                ::close(shm_fd);
+                return Result<SharedMemory>(error);
+            }
+        } else {
+            // Open existing shared memory
+            shm_fd = ::shm_open(shm_name.c_str(), O_RDWR, 0666);
+
+            if (shm_fd == -1) {
+                return Result<SharedMemory>(platform::PlatformPosix::get_last_error());
+            }
         }
 
-        // Set size
-        if (::ftruncate(shm_fd, static_cast<off_t>(size)) == -1) {
+        // Map the memory
+        data = ::mmap(
+            nullptr,
+            size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED,
+            shm_fd,
+            0
+        );
+
+        if (data == MAP_FAILED) {
             ErrorCode error = platform::PlatformPosix::get_last_error();
             ::close(shm_fd);
             return Result<SharedMemory>(error);
         }
-    } else {
-        // Open existing shared memory
-        shm_fd = ::shm_open(shm_name.c_str(), O_RDWR, 0666);
 
-        if (shm_fd == -1) {
-            return Result<SharedMemory>(platform::PlatformPosix::get_last_error());
+#if defined(MADV_HUGEPAGE)
+        // Fallback: transparent huge pages, where shmem THP is enabled.
+        // Must come before any page is faulted in.
+        if (options.huge_pages) {
+            ::madvise(data, size, MADV_HUGEPAGE);
         }
+#endif
     }
 
-    // Map the memory
-    void* data = ::mmap(
-        nullptr,
-        size,
-        PROT_READ | PROT_WRITE,
-        MAP_SHARED,
-        shm_fd,
-        0
-    );
+    // Placement goes before prefaulting, so new pages land on the right node
+    if (const int error = apply_numa_policy(data, size, options.numa_policy, options.numa_node)) {
+        errno = error;
+        ErrorCode code = platform::PlatformPosix::get_last_error();
+        ::munmap(data, size);
+        ::close(shm_fd);
+        return Result<SharedMemory>(code);
+    }
 
-    if (data == MAP_FAILED) {
+    if (options.prefault) {
+        prefault(data, size);
+    }
+
+    if (options.lock && ::mlock(data, size) == -1) {
         ErrorCode error = platform::PlatformPosix::get_last_error();
+        ::munmap(data, size);
         ::close(shm_fd);
         return Result<SharedMemory>(error);
     }
@@ -101,9 +274,9 @@ Result<SharedMemory> SharedMemory::create_or_open(
     // Store fd as void* (cast to intptr_t first to avoid warnings)
     void* handle = reinterpret_cast<void*>(static_cast<intptr_t>(shm_fd));
 
-    return Result<SharedMemory>(
-        SharedMemory(name, data, size, handle)
-    );
+    SharedMemory memory(name, data, size, handle);
+    memory.huge_pages_ = huge;
+    return Result<SharedMemory>(std::move(memory));
 }
 
 void SharedMemory::close() {
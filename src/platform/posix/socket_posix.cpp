@@ -2,15 +2,291 @@
 
 #ifndef _WIN32
 
-// POSIX socket implementation (for future use)
-// Currently, we're using shared memory for the main IPC
-// Unix domain sockets can be used for control/handshake channels
+#include "../../ipc/notify.hpp"
+#include "swiftchannel/sender/notify.hpp"
+
+#include <unistd.h>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#define SWIFTCHANNEL_HAS_EVENTFD 1
+#endif
+
+// Unix domain socket helpers for ChannelFlags::NotifyFd
+// The receiver listens on a socket named after the channel and answers each
+// connection with its eventfd (SCM_RIGHTS); producers connect once and keep
+// the fd. Neither side ever waits for the other. Linux only: elsewhere no
+// receiver offers an fd.
 
 namespace swiftchannel::platform {
 
-// TODO: Implement Unix domain socket helpers if needed for control channel
-// For now, shared memory is sufficient
+#if defined(SWIFTCHANNEL_HAS_EVENTFD)
+
+namespace {
+
+// Address of a channel's notification socket, in the abstract namespace
+// (nothing is left behind in the file system if the receiver dies)
+socklen_t notify_address(const std::string& channel_name, sockaddr_un& address) {
+    const std::string name = "swiftchannel_" + channel_name;
+    if (name.size() + 1 > sizeof(address.sun_path)) {
+        errno = ENAMETOOLONG;
+        return 0;
+    }
+
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path + 1, name.data(), name.size());  // sun_path[0] = 0
+    return static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + 1 + name.size());
+}
+
+// Whether the other end of a connected socket runs as our user (and, if
+// pid is nonzero, is that process). The abstract socket name is open to
+// every local process; this keeps others from taking or planting the fd.
+bool peer_trusted(int socket, uint32_t pid) {
+    ucred credentials{};
+    socklen_t length = sizeof(credentials);
+    if (::getsockopt(socket, SOL_SOCKET, SO_PEERCRED, &credentials, &length) != 0) {
+        return false;
+    }
+    return credentials.uid == ::geteuid() &&
+           (pid == 0 || static_cast<uint32_t>(credentials.pid) == pid);
+}
+
+// Pass fd over a connected socket
+bool send_fd(int socket, int fd) {
+    char byte = 0;
+    iovec data{&byte, 1};
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message{};
+    message.msg_iov = &data;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(header), &fd, sizeof(int));
+
+    return ::sendmsg(socket, &message, MSG_NOSIGNAL) == 1;
+}
+
+// Receive an fd passed with send_fd, without waiting
+// Returns -1 with errno EAGAIN if it has not been sent yet.
+int receive_fd(int socket) {
+    char byte = 0;
+    iovec data{&byte, 1};
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr message{};
+    message.msg_iov = &data;
+    message.msg_iovlen = 1;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    const ssize_t received = ::recvmsg(socket, &message, MSG_CMSG_CLOEXEC | MSG_DONTWAIT);
+    if (received != 1) {
+        if (received == 0) {
+            errno = ECONNRESET;  // Closed without an answer
+        }
+        return -1;
+    }
+
+    cmsghdr* header = CMSG_FIRSTHDR(&message);
+    if (header == nullptr || header->cmsg_level != SOL_SOCKET ||
+        header->cmsg_type != SCM_RIGHTS || header->cmsg_len != CMSG_LEN(sizeof(int))) {
+        errno = EBADMSG;
+        return -1;
+    }
+
+    int fd = -1;
+    std::memcpy(&fd, CMSG_DATA(header), sizeof(int));
+    return fd;
+}
+
+// Ask the channel's receiver for its eventfd (-1 if nobody listens)
+// The connection is queued without waiting; the receiver answers it the
+// next time it finds the channel empty (see receive_fd).
+int request_event_fd(const std::string& channel_name) {
+    sockaddr_un address;
+    const socklen_t length = notify_address(channel_name, address);
+    if (length == 0) {
+        return -1;
+    }
+
+    int socket = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (socket < 0) {
+        return -1;
+    }
+
+    if (::connect(socket, reinterpret_cast<sockaddr*>(&address), length) != 0) {
+        ::close(socket);  // No receiver, or its backlog is full
+        return -1;
+    }
+    return socket;
+}
+
+} // namespace
+
+#endif // SWIFTCHANNEL_HAS_EVENTFD
 
 } // namespace swiftchannel::platform
 
+namespace swiftchannel {
+
+NotifySender::NotifySender(std::string channel_name, uint32_t generation) noexcept
+    : channel_name_(std::move(channel_name))
+    , generation_(generation)
+{
+    request();
+}
+
+NotifySender::~NotifySender() {
+    for (int fd : {fd_, request_}) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+}
+
+void NotifySender::request() noexcept {
+#if defined(SWIFTCHANNEL_HAS_EVENTFD)
+    for (int* fd : {&fd_, &request_}) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+    request_ = platform::request_event_fd(channel_name_);
+#endif
+}
+
+void NotifySender::signal(SharedMemoryHeader* header) noexcept {
+#if defined(SWIFTCHANNEL_HAS_EVENTFD)
+    // A receiver that opened its fd after us has not seen our request
+    // (pairs with the release in Receiver::native_handle)
+    const uint32_t generation = header->notify_generation.load(std::memory_order_acquire);
+    if (generation != generation_) {
+        generation_ = generation;
+        request();
+    }
+
+    // Pick up the answer if it is there; never wait for it. Whoever holds
+    // the socket name must be the receiver that armed the channel.
+    if (fd_ < 0 && request_ >= 0) {
+        const uint32_t receiver =
+            std::atomic_ref<uint32_t>(header->receiver_pid).load(std::memory_order_relaxed);
+        if (receiver != 0 && platform::peer_trusted(request_, receiver)) {
+            fd_ = platform::receive_fd(request_);
+        } else {
+            errno = EACCES;  // Someone else holds the name; drop the request
+        }
+        if (fd_ >= 0 || errno != EAGAIN) {
+            ::close(request_);
+            request_ = -1;
+        }
+    }
+
+    if (fd_ >= 0) {
+        const uint64_t one = 1;
+        [[maybe_unused]] ssize_t written = ::write(fd_, &one, sizeof(one));
+    }
+#else
+    (void)header;
+#endif
+}
+
+NotifyListener::~NotifyListener() {
+    close();
+}
+
+Result<void> NotifyListener::open(const std::string& channel_name) {
+#if defined(SWIFTCHANNEL_HAS_EVENTFD)
+    sockaddr_un address;
+    const socklen_t length = platform::notify_address(channel_name, address);
+    if (length == 0) {
+        return Result<void>(ErrorCode::InvalidChannelName);
+    }
+
+    event_fd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+
+    bool ok = event_fd_ >= 0 && listen_fd_ >= 0 && epoll_fd_ >= 0 &&
+              ::bind(listen_fd_, reinterpret_cast<sockaddr*>(&address), length) == 0 &&
+              ::listen(listen_fd_, SOMAXCONN) == 0;
+
+    // Level-triggered: readable while data is signalled or a producer waits
+    for (int fd : {event_fd_, listen_fd_}) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        ok = ok && ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) == 0;
+    }
+
+    if (!ok) {
+        ErrorCode error = platform::PlatformPosix::get_last_error();
+        close();
+        return Result<void>(error);
+    }
+    return Result<void>();
+#else
+    (void)channel_name;
+    return Result<void>(ErrorCode::InvalidOperation);
+#endif
+}
+
+void NotifyListener::close() noexcept {
+    for (int* fd : {&epoll_fd_, &listen_fd_, &event_fd_}) {
+        if (*fd >= 0) {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+}
+
+void NotifyListener::serve() noexcept {
+#if defined(SWIFTCHANNEL_HAS_EVENTFD)
+    // One look at the epoll set; nothing else unless something is pending
+    epoll_event events[2];
+    const int ready = ::epoll_wait(epoll_fd_, events, 2, 0);
+    for (int i = 0; i < ready; ++i) {
+        if (events[i].data.fd == listen_fd_) {
+            for (;;) {
+                int peer = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+                if (peer < 0) {
+                    break;  // EAGAIN: nobody else is waiting
+                }
+                if (platform::peer_trusted(peer, 0)) {
+                    platform::send_fd(peer, event_fd_);
+                }
+                ::close(peer);
+            }
+        } else {
+            uint64_t count = 0;
+            [[maybe_unused]] ssize_t drained = ::read(event_fd_, &count, sizeof(count));
+        }
+    }
+#endif
+}
+
+void NotifyListener::signal() noexcept {
+#if defined(SWIFTCHANNEL_HAS_EVENTFD)
+    const uint64_t one = 1;
+    [[maybe_unused]] ssize_t written = ::write(event_fd_, &one, sizeof(one));
+#endif
+}
+
+} // namespace swiftchannel
+
 #endif // !_WIN32
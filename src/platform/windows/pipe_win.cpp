@@ -2,6 +2,9 @@
 
 #ifdef _WIN32
 
+#include "../../ipc/notify.hpp"
+#include "swiftchannel/sender/notify.hpp"
+
 // Windows named pipe implementation (for future use)
 // Currently, we're using shared memory for the main IPC
 // Named pipes can be used for control/handshake channels
@@ -13,4 +16,37 @@ namespace swiftchannel::platform {
 
 } // namespace swiftchannel::platform
 
+namespace swiftchannel {
+
+// ChannelFlags::NotifyFd has no Windows transport yet: receivers offer no
+// handle, so producers are never asked to signal one
+
+NotifySender::NotifySender(std::string channel_name, uint32_t generation) noexcept
+    : channel_name_(std::move(channel_name))
+    , generation_(generation)
+{}
+
+NotifySender::~NotifySender() = default;
+
+void NotifySender::request() noexcept {}
+
+void NotifySender::signal(SharedMemoryHeader* header) noexcept {
+    (void)header;
+}
+
+NotifyListener::~NotifyListener() = default;
+
+Result<void> NotifyListener::open(const std::string& channel_name) {
+    (void)channel_name;
+    return Result<void>(ErrorCode::InvalidOperation);
+}
+
+void NotifyListener::close() noexcept {}
+
+void NotifyListener::serve() noexcept {}
+
+void NotifyListener::signal() noexcept {}
+
+} // namespace swiftchannel
+
 #endif // _WIN32
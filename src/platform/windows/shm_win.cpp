@@ -7,6 +7,8 @@
 #include "swiftchannel/sender/channel.hpp"
 #include "swiftchannel/common/alignment.hpp"
 
+#include <atomic>
+
 namespace swiftchannel::platform {
 
 std::wstring PlatformWin::to_shared_memory_name(const std::string& channel_name) {
@@ -73,10 +75,13 @@ uint32_t PlatformWin::get_process_id() {
 namespace swiftchannel {
 
 // Windows implementation of SharedMemory::create_or_open
+// Large pages need SeLockMemoryPrivilege and a non-shared section, so
+// options.huge_pages is ignored here.
 Result<SharedMemory> SharedMemory::create_or_open(
     const std::string& name,
     size_t size,
-    bool create)
+    bool create,
+    const MappingOptions& options)
 {
     std::wstring wide_name = platform::PlatformWin::to_shared_memory_name(name);
 
@@ -129,6 +134,23 @@ Result<SharedMemory> SharedMemory::create_or_open(
         return Result<SharedMemory>(error);
     }
 
+    if (options.prefault) {
+        // Atomic no-op writes: the peer may already be using the memory
+        SYSTEM_INFO info;
+        ::GetSystemInfo(&info);
+        auto* bytes = static_cast<uint8_t*>(data);
+        for (size_t offset = 0; offset < size; offset += info.dwPageSize) {
+            std::atomic_ref<uint8_t>(bytes[offset]).fetch_add(0, std::memory_order_relaxed);
+        }
+    }
+
+    if (options.lock && !::VirtualLock(data, size)) {
+        ErrorCode error = platform::PlatformWin::get_last_error();
+        ::UnmapViewOfFile(data);
+        ::CloseHandle(file_mapping);
+        return Result<SharedMemory>(error);
+    }
+
     return Result<SharedMemory>(
         SharedMemory(name, data, size, file_mapping)
     );
@@ -0,0 +1,247 @@
+#include "swiftchannel/receiver/channel_set.hpp"
+#include "swiftchannel/common/futex.hpp"
+#include "swiftchannel/common/wait.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+namespace swiftchannel {
+
+struct ChannelSet::Member {
+    std::unique_ptr<Receiver> receiver;
+    MessageHandler handler;
+    uint32_t weight;
+    size_t budget;  // Messages per round
+};
+
+// One serving thread's share of the channels
+struct ChannelSet::Worker {
+    explicit Worker(const ChannelSetConfig& config)
+        : waiter(config.wait_strategy, config.wait_sleep_us * 1000)
+    {}
+
+    std::vector<Member*> members;  // Heaviest first under Weighted
+    size_t next = 0;               // First member of the next round (RoundRobin)
+    size_t load = 0;               // Sum of member budgets
+    Waiter waiter;
+    std::vector<FutexWaitEntry> parked;       // Reused by wait_idle
+    std::vector<SharedMemoryHeader*> waiting;  // Channels parked[1..] belong to
+    std::thread thread;
+};
+
+namespace {
+
+// Visiting order for a round: by weight under Weighted, else as added
+template<typename Members>
+void order(Members& members, SchedulingPolicy policy) {
+    if (policy == SchedulingPolicy::Weighted) {
+        std::stable_sort(members.begin(), members.end(), [](const auto& a, const auto& b) {
+            return a->weight > b->weight;
+        });
+    }
+}
+
+} // namespace
+
+ChannelSet::ChannelSet(const ChannelSetConfig& config)
+    : config_(config)
+    , poller_(std::make_unique<Worker>(config))
+{
+    config_.burst = std::max<size_t>(config_.burst, 1);
+    config_.threads = std::max<size_t>(config_.threads, 1);
+}
+
+ChannelSet::~ChannelSet() {
+    stop();
+}
+
+Result<size_t> ChannelSet::add(const std::string& channel_name, MessageHandler handler,
+                               const ChannelConfig& config, uint32_t weight) {
+    if (running_.load(std::memory_order_acquire) || weight == 0) {
+        return Result<size_t>(ErrorCode::InvalidOperation);
+    }
+
+    auto receiver = std::make_unique<Receiver>(channel_name, config);
+    if (receiver->ring_ == nullptr) {
+        return Result<size_t>(receiver->open_error());
+    }
+
+    const size_t budget = (config_.policy == SchedulingPolicy::Weighted)
+                              ? config_.burst * weight : config_.burst;
+    members_.push_back(std::make_unique<Member>(
+        Member{std::move(receiver), std::move(handler), weight, budget}));
+
+    poller_->members.push_back(members_.back().get());
+    poller_->load += budget;
+    order(poller_->members, config_.policy);
+    return Result<size_t>(members_.size() - 1);
+}
+
+Result<size_t> ChannelSet::poll() {
+    if (running_.load(std::memory_order_acquire)) {
+        return Result<size_t>(ErrorCode::InvalidOperation);
+    }
+    return Result<size_t>(serve_round(*poller_));
+}
+
+Result<void> ChannelSet::start() {
+    if (running_.exchange(true, std::memory_order_acq_rel)) {
+        return Result<void>(ErrorCode::InvalidOperation);
+    }
+    serve(*poller_);
+    return Result<void>();
+}
+
+Result<void> ChannelSet::start_async() {
+    if (running_.exchange(true, std::memory_order_acq_rel)) {
+        return Result<void>(ErrorCode::InvalidOperation);
+    }
+
+    // Heaviest channels first, each to the least loaded thread
+    const size_t threads = std::min(config_.threads, std::max<size_t>(members_.size(), 1));
+    for (size_t i = 0; i < threads; ++i) {
+        workers_.push_back(std::make_unique<Worker>(config_));
+    }
+
+    std::vector<Member*> by_budget = poller_->members;
+    std::stable_sort(by_budget.begin(), by_budget.end(), [](const Member* a, const Member* b) {
+        return a->budget > b->budget;
+    });
+    for (Member* member : by_budget) {
+        auto lightest = std::min_element(workers_.begin(), workers_.end(),
+            [](const auto& a, const auto& b) { return a->load < b->load; });
+        (*lightest)->members.push_back(member);
+        (*lightest)->load += member->budget;
+    }
+
+    for (auto& worker : workers_) {
+        order(worker->members, config_.policy);
+        worker->thread = std::thread([this, target = worker.get()]() {
+            serve(*target);
+        });
+    }
+    return Result<void>();
+}
+
+void ChannelSet::stop() {
+    running_.store(false, std::memory_order_release);
+
+    // A parked worker only notices once woken
+    stop_futex_.fetch_add(1, std::memory_order_release);
+    futex_wake_all(&stop_futex_);
+
+    for (auto& worker : workers_) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+    workers_.clear();
+}
+
+bool ChannelSet::is_running() const noexcept {
+    return running_.load(std::memory_order_acquire);
+}
+
+size_t ChannelSet::size() const noexcept {
+    return members_.size();
+}
+
+Receiver& ChannelSet::receiver(size_t index) {
+    return *members_.at(index)->receiver;
+}
+
+ChannelSet::Stats ChannelSet::get_stats() const noexcept {
+    Stats stats{};
+    for (const auto& member : members_) {
+        stats.messages_received += member->receiver->get_stats().messages_received;
+    }
+    stats.rounds = rounds_.load(std::memory_order_relaxed);
+    stats.parks = parks_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+size_t ChannelSet::serve_round(Worker& worker) {
+    const size_t count = worker.members.size();
+    size_t handled = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        Member& member = *worker.members[(worker.next + i) % count];
+        auto drained = member.receiver->drain(member.budget,
+                                              MessageHandler(std::ref(member.handler)));
+        if (drained.is_ok()) {
+            handled += drained.value();
+        }
+    }
+
+    // Rotate who goes first, so no channel is always served last
+    if (config_.policy == SchedulingPolicy::RoundRobin && count != 0) {
+        worker.next = (worker.next + 1) % count;
+    }
+    rounds_.fetch_add(1, std::memory_order_relaxed);
+    return handled;
+}
+
+void ChannelSet::wait_idle(Worker& worker) {
+    auto ready = [&] {
+        if (!running_.load(std::memory_order_acquire)) {
+            return true;
+        }
+        for (const Member* member : worker.members) {
+            if (member->receiver->ring_->readable(member->receiver->header_)) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    parks_.fetch_add(1, std::memory_order_relaxed);
+    worker.waiter.idle(0, nullptr, ready, [&](uint64_t park_ns) {
+        // Register as a waiter on every blocking channel, as
+        // RingBuffer::wait_for_data does for one, then sleep on all of them
+        // and on stop_futex_ at once
+        worker.parked.clear();
+        worker.waiting.clear();
+        worker.parked.push_back({&stop_futex_, stop_futex_.load(std::memory_order_acquire)});
+
+        bool watched_all = true;
+        for (const Member* member : worker.members) {
+            RingBuffer* ring = member->receiver->ring_;
+            SharedMemoryHeader* header = member->receiver->header_;
+            if (!ring->blocking() || worker.parked.size() == FUTEX_WAIT_ANY_MAX) {
+                watched_all = false;
+                continue;
+            }
+            worker.parked.push_back({&header->data_futex,
+                                     header->data_futex.load(std::memory_order_acquire)});
+            header->data_waiters.fetch_add(1, std::memory_order_relaxed);
+            worker.waiting.push_back(header);
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);  // Pairs with notify_consumers
+
+        // Channels that cannot wake us are re-checked every wait_sleep_us
+        const uint64_t sleep_ns = config_.wait_sleep_us * 1000;
+        if (!watched_all && (park_ns == 0 || park_ns > sleep_ns)) {
+            park_ns = sleep_ns;
+        }
+        if (!ready()) {
+            futex_wait_any(worker.parked, park_ns);
+        }
+
+        for (SharedMemoryHeader* header : worker.waiting) {
+            header->data_waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+    });
+}
+
+void ChannelSet::serve(Worker& worker) {
+    while (running_.load(std::memory_order_acquire)) {
+        if (serve_round(worker) == 0) {
+            wait_idle(worker);
+        } else {
+            worker.waiter.progress();
+        }
+    }
+}
+
+} // namespace swiftchannel
@@ -1,9 +1,112 @@
 #include "receiver_impl.hpp"
+#include "swiftchannel/receiver/dispatcher.hpp"
 
 namespace swiftchannel {
 
-// Message dispatch logic (can be extended for routing, filtering, etc.)
-// Currently handled inline in receiver.cpp
-// This file is a placeholder for future dispatch enhancements
+// Dispatcher registration and fallback paths (dispatch itself is inline)
+
+namespace {
+
+// Table slots to start with; room for 32 types before the first rehash
+constexpr size_t INITIAL_SLOTS = 64;
+
+} // namespace
+
+Dispatcher::Dispatcher()
+    : table_(INITIAL_SLOTS, Entry{0, nullptr, nullptr})
+    , mask_(INITIAL_SLOTS - 1)
+{}
+
+Dispatcher::~Dispatcher() = default;
+
+// A moved-from dispatcher keeps a valid (empty) table, so dispatch on it
+// routes everything to the unknown handler instead of probing nothing
+Dispatcher::Dispatcher(Dispatcher&& other) noexcept
+    : table_(std::move(other.table_))
+    , mask_(other.mask_)
+    , registrations_(std::move(other.registrations_))
+    , unknown_(std::move(other.unknown_))
+    , stats_(other.stats_)
+{
+    other.reseed();
+}
+
+Dispatcher& Dispatcher::operator=(Dispatcher&& other) noexcept {
+    if (this != &other) {
+        table_ = std::move(other.table_);
+        mask_ = other.mask_;
+        registrations_ = std::move(other.registrations_);
+        unknown_ = std::move(other.unknown_);
+        stats_ = other.stats_;
+        other.reseed();
+    }
+    return *this;
+}
+
+void Dispatcher::reseed() noexcept {
+    // A single free slot: the smallest table every probe ends in
+    table_.assign(1, Entry{0, nullptr, nullptr});
+    mask_ = 0;
+    registrations_.clear();
+    unknown_ = nullptr;
+    stats_ = Stats{};
+}
+
+Result<void> Dispatcher::insert(uint32_t type_id, const void* tag, Thunk thunk,
+                                HandlerPtr handler) {
+    void* target = handler.get();
+
+    for (auto& registration : registrations_) {
+        if (registration.type_id != type_id) {
+            continue;
+        }
+        if (registration.type_tag != tag) {
+            return Result<void>(ErrorCode::InvalidOperation);  // Id collision
+        }
+
+        // Same type again: swap the handler in place
+        for (size_t i = type_id & mask_;; i = (i + 1) & mask_) {
+            if (table_[i].type_id == type_id) {
+                table_[i].thunk = thunk;
+                table_[i].target = target;
+                break;
+            }
+        }
+        registration.handler = std::move(handler);
+        return Result<void>();
+    }
+
+    registrations_.push_back(Registration{type_id, tag, std::move(handler)});
+
+    // Keep the table at most half full so probes stay short
+    if (2 * registrations_.size() > table_.size()) {
+        std::vector<Entry> old = std::move(table_);
+        table_.assign(2 * old.size(), Entry{0, nullptr, nullptr});
+        mask_ = table_.size() - 1;
+        for (const auto& entry : old) {
+            if (entry.type_id != 0) {
+                place(entry);
+            }
+        }
+    }
+
+    place(Entry{type_id, thunk, target});
+    return Result<void>();
+}
+
+void Dispatcher::place(const Entry& entry) noexcept {
+    size_t i = entry.type_id & mask_;
+    while (table_[i].type_id != 0) {
+        i = (i + 1) & mask_;
+    }
+    table_[i] = entry;
+}
+
+void Dispatcher::route_unknown(uint32_t type_id, const void* data, size_t size) {
+    ++stats_.unknown;
+    if (unknown_) {
+        unknown_(type_id, data, size);
+    }
+}
 
 } // namespace swiftchannel
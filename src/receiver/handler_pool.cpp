@@ -0,0 +1,373 @@
+#include "swiftchannel/receiver/handler_pool.hpp"
+#include "swiftchannel/common/futex.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <deque>
+#include <limits>
+#include <mutex>
+
+namespace swiftchannel {
+
+namespace {
+
+constexpr uint64_t NONE = std::numeric_limits<uint64_t>::max();
+
+// Messages a lane handles before it goes to the back of the queue
+constexpr size_t LANE_BURST = 32;
+
+// Messages peeked per pass of the receive thread
+constexpr size_t RECEIVE_BATCH = 256;
+
+} // namespace
+
+// A message handed out to the pool
+struct HandlerPool::Slot {
+    const void* data;
+    size_t size;
+    uint64_t end;    // Ring position just past it
+    uint64_t next;   // Next sequence in the same lane (NONE = last)
+    std::atomic<bool> done;
+};
+
+// Messages of one lane waiting for a thread, linked through their slots
+struct HandlerPool::Lane {
+    std::mutex mutex;
+    uint64_t first = NONE;
+    uint64_t last = NONE;
+    bool scheduled = false;  // In a queue or being run
+};
+
+// A handler thread's lanes; the owner takes from the front, thieves from
+// the back
+struct HandlerPool::Queue {
+    std::mutex mutex;
+    std::deque<uint32_t> lanes;
+};
+
+HandlerPool::HandlerPool(Receiver& receiver, const HandlerPoolConfig& config)
+    : receiver_(receiver)
+    , config_(config)
+    , waiter_(config.wait_strategy, config.wait_sleep_us * 1000)
+{
+    config_.threads = std::max<size_t>(config_.threads, 1);
+    config_.max_in_flight = std::max<size_t>(config_.max_in_flight, 1);
+    config_.lanes = std::bit_ceil(std::max<size_t>(config_.lanes, 1));
+
+    const size_t slots = std::bit_ceil(config_.max_in_flight);
+    slots_ = std::make_unique<Slot[]>(slots);
+    slot_mask_ = slots - 1;
+    lanes_ = std::make_unique<Lane[]>(config_.lanes);
+    lane_mask_ = static_cast<uint32_t>(config_.lanes - 1);
+    queues_ = std::make_unique<Queue[]>(config_.threads);
+}
+
+HandlerPool::~HandlerPool() {
+    stop();
+}
+
+Result<void> HandlerPool::start(MessageHandler handler, KeyExtractor key) {
+    auto entered = enter(std::move(handler), std::move(key));
+    if (entered.is_error()) {
+        return entered;
+    }
+    serve();
+    return Result<void>();
+}
+
+Result<void> HandlerPool::start_async(MessageHandler handler, KeyExtractor key) {
+    if (receive_thread_.joinable()) {
+        return Result<void>(ErrorCode::InvalidOperation);
+    }
+    auto entered = enter(std::move(handler), std::move(key));
+    if (entered.is_error()) {
+        return entered;
+    }
+    receive_thread_ = std::thread([this]() { serve(); });
+    return Result<void>();
+}
+
+void HandlerPool::stop() {
+    receiver_.stop();
+
+    // The receive thread may be parked waiting for a handler
+    handled_futex_.fetch_add(1, std::memory_order_release);
+    futex_wake_all(&handled_futex_);
+
+    if (receive_thread_.joinable()) {
+        receive_thread_.join();
+    }
+}
+
+bool HandlerPool::is_running() const noexcept {
+    return receiver_.is_running();
+}
+
+HandlerPool::Stats HandlerPool::get_stats() const noexcept {
+    return Stats{dispatched_.load(std::memory_order_relaxed),
+                 handled_.load(std::memory_order_relaxed),
+                 steals_.load(std::memory_order_relaxed),
+                 stalls_.load(std::memory_order_relaxed)};
+}
+
+Result<void> HandlerPool::enter(MessageHandler handler, KeyExtractor key) {
+    if (receiver_.ring_ == nullptr) {
+        return Result<void>(receiver_.open_error());
+    }
+    // Overwrite channels cannot hold space; a running receiver has a reader
+    if (receiver_.ring_->overwrites() || receiver_.is_running()) {
+        return Result<void>(ErrorCode::InvalidOperation);
+    }
+
+    auto entered = receiver_.enter_run();
+    if (entered.is_error()) {
+        return entered;
+    }
+    handler_ = std::move(handler);
+    key_ = std::move(key);
+    return Result<void>();
+}
+
+void HandlerPool::serve() {
+    RingBuffer* ring = receiver_.ring_;
+    SharedMemoryHeader* header = receiver_.header_;
+
+    head_ = 0;
+    tail_ = 0;
+    ring->release(header);  // Whatever Receiver::next() still holds
+    scan_ = ring->read_cursor(header);
+
+    workers_running_.store(true, std::memory_order_release);
+    for (size_t i = 0; i < config_.threads; ++i) {
+        workers_.emplace_back([this, i]() { worker_loop(i); });
+    }
+
+    while (receiver_.is_running()) {
+        const bool reclaimed = reclaim();
+
+        const size_t room = config_.max_in_flight - static_cast<size_t>(head_ - tail_);
+        size_t count = 0;
+        if (room != 0) {
+            count = ring->peek_from(scan_, std::min(room, RECEIVE_BATCH),
+                [this](std::span<const uint8_t> payload, uint64_t end) {
+                    hand_out(payload, end);
+                }, header);
+        } else {
+            stalls_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Records dropped or skipped behind nothing in flight
+        if (head_ == tail_) {
+            ring->release_to(scan_, header);
+        }
+
+        if (count == 0 && !reclaimed) {
+            idle(room != 0);
+        } else {
+            waiter_.progress();
+        }
+    }
+
+    // Everything handed out is still owed a handler call
+    while (head_ != tail_) {
+        if (!reclaim()) {
+            idle(false);
+        }
+    }
+    ring->release_to(scan_, header);
+
+    workers_running_.store(false, std::memory_order_release);
+    work_futex_.fetch_add(1, std::memory_order_release);
+    futex_wake_all(&work_futex_);
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+}
+
+void HandlerPool::hand_out(std::span<const uint8_t> payload, uint64_t end) {
+    const uint64_t sequence = head_++;
+    Slot& slot = slots_[sequence & slot_mask_];
+    slot.data = payload.data();
+    slot.size = payload.size();
+    slot.end = end;
+    slot.next = NONE;
+    slot.done.store(false, std::memory_order_relaxed);
+
+    const uint64_t key = key_ ? key_(payload.data(), payload.size())
+                              : receiver_.ring_->last_type_id();
+    const auto lane = static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & lane_mask_;
+
+    Lane& target = lanes_[lane];
+    bool idle_lane = false;
+    {
+        std::lock_guard<std::mutex> lock(target.mutex);
+        if (target.last == NONE) {
+            target.first = sequence;
+        } else {
+            slots_[target.last & slot_mask_].next = sequence;
+        }
+        target.last = sequence;
+        idle_lane = !target.scheduled;
+        target.scheduled = true;
+    }
+    if (idle_lane) {
+        schedule(lane, lane % config_.threads);
+    }
+
+    dispatched_.fetch_add(1, std::memory_order_relaxed);
+    ++receiver_.inline_messages_;
+    receiver_.inline_bytes_ += payload.size();
+}
+
+void HandlerPool::schedule(uint32_t lane, size_t queue) {
+    {
+        std::lock_guard<std::mutex> lock(queues_[queue].mutex);
+        queues_[queue].lanes.push_back(lane);
+    }
+    queued_.fetch_add(1, std::memory_order_seq_cst);
+
+    // Pairs with the fence in worker_loop: either it sees queued_ or we
+    // see it idle
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idle_workers_.load(std::memory_order_relaxed) != 0) {
+        work_futex_.fetch_add(1, std::memory_order_release);
+        futex_wake_one(&work_futex_);
+    }
+}
+
+bool HandlerPool::take(size_t index, uint32_t& lane) {
+    for (size_t i = 0; i < config_.threads; ++i) {
+        Queue& queue = queues_[(index + i) % config_.threads];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.lanes.empty()) {
+            continue;
+        }
+        if (i == 0) {
+            lane = queue.lanes.front();
+            queue.lanes.pop_front();
+        } else {
+            lane = queue.lanes.back();
+            queue.lanes.pop_back();
+            steals_.fetch_add(1, std::memory_order_relaxed);
+        }
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void HandlerPool::worker_loop(size_t index) {
+    for (;;) {
+        uint32_t lane = 0;
+        if (take(index, lane)) {
+            run_lane(index, lane);
+            continue;
+        }
+        if (!workers_running_.load(std::memory_order_acquire)) {
+            return;  // Stopped, and no lane left anywhere
+        }
+
+        const uint32_t seen = work_futex_.load(std::memory_order_acquire);
+        idle_workers_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (queued_.load(std::memory_order_relaxed) == 0 &&
+            workers_running_.load(std::memory_order_acquire)) {
+            futex_wait(&work_futex_, seen, 0);
+        }
+        idle_workers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+void HandlerPool::run_lane(size_t index, uint32_t lane) {
+    Lane& source = lanes_[lane];
+
+    for (size_t i = 0; i < LANE_BURST; ++i) {
+        uint64_t sequence = NONE;
+        {
+            std::lock_guard<std::mutex> lock(source.mutex);
+            if (source.first == NONE) {
+                source.scheduled = false;
+                return;
+            }
+            sequence = source.first;
+            source.first = slots_[sequence & slot_mask_].next;
+            if (source.first == NONE) {
+                source.last = NONE;
+            }
+        }
+
+        Slot& slot = slots_[sequence & slot_mask_];
+        handler_(slot.data, slot.size);
+        slot.done.store(true, std::memory_order_release);
+        handled_.fetch_add(1, std::memory_order_relaxed);
+
+        // Pairs with the fence in idle()
+        handled_futex_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (receiver_parked_.load(std::memory_order_relaxed) != 0) {
+            futex_wake_all(&handled_futex_);
+        }
+    }
+
+    // Burst used up: other lanes go first, this one stays scheduled
+    schedule(lane, index);
+}
+
+bool HandlerPool::reclaim() {
+    uint64_t end = 0;
+    const uint64_t oldest = tail_;
+    while (tail_ != head_ && slots_[tail_ & slot_mask_].done.load(std::memory_order_acquire)) {
+        end = slots_[tail_ & slot_mask_].end;
+        ++tail_;
+    }
+    if (tail_ == oldest) {
+        return false;
+    }
+    receiver_.ring_->release_to(end, receiver_.header_);
+    return true;
+}
+
+void HandlerPool::idle(bool want_data) {
+    RingBuffer* ring = receiver_.ring_;
+    SharedMemoryHeader* header = receiver_.header_;
+
+    auto ready = [&] {
+        if (tail_ != head_ && slots_[tail_ & slot_mask_].done.load(std::memory_order_acquire)) {
+            return true;
+        }
+        return want_data && (!receiver_.is_running() ||
+                             header->write_index.load(std::memory_order_acquire) > scan_);
+    };
+
+    waiter_.idle(0, nullptr, ready, [&](uint64_t park_ns) {
+        // Sleep on handled_futex_ and, when waiting for data on a blocking
+        // channel, on its data futex too (registered as RingBuffer does)
+        FutexWaitEntry entries[2] = {
+            {&handled_futex_, handled_futex_.load(std::memory_order_acquire)},
+            {&header->data_futex, header->data_futex.load(std::memory_order_acquire)},
+        };
+        const bool on_data = want_data && ring->blocking();
+        if (on_data) {
+            header->data_waiters.fetch_add(1, std::memory_order_relaxed);
+        }
+        receiver_parked_.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // A channel that cannot wake us is re-checked every wait_sleep_us
+        const uint64_t sleep_ns = config_.wait_sleep_us * 1000;
+        if (want_data && !on_data && (park_ns == 0 || park_ns > sleep_ns)) {
+            park_ns = sleep_ns;
+        }
+        if (!ready()) {
+            futex_wait_any(std::span<const FutexWaitEntry>(entries, on_data ? 2 : 1), park_ns);
+        }
+
+        receiver_parked_.store(0, std::memory_order_relaxed);
+        if (on_data) {
+            header->data_waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+    });
+}
+
+} // namespace swiftchannel
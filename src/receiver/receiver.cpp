@@ -1,9 +1,16 @@
 #include "receiver_impl.hpp"
 #include "swiftchannel/sender/channel.hpp"
 #include "swiftchannel/sender/ring_buffer.hpp"
+#include "swiftchannel/common/timestamp.hpp"
+#include "swiftchannel/common/numa.hpp"
+#include "swiftchannel/common/wait.hpp"
+#include "../ipc/handshake.hpp"
+#include "../ipc/notify.hpp"
 
 #include <chrono>
+#include <span>
 #include <thread>
+#include <vector>
 
 namespace swiftchannel {
 
@@ -14,48 +21,101 @@ public:
         : channel_name_(channel_name)
         , config_(config)
         , running_(false)
+        , waiter_(config.wait_strategy, config.wait_sleep_us * 1000)
     {
+        // The consumer's node is the one we are running on now
+        ChannelConfig open_config = config;
+        if (config.numa_policy == NumaPolicy::ConsumerNode) {
+            open_config.numa_policy = NumaPolicy::Bind;
+            open_config.numa_node = current_numa_node();
+        }
+
         // Open the existing channel (created by sender)
-        auto result = Channel::open(channel_name, config);
+        auto result = Channel::open(channel_name, open_config);
         if (result.is_ok()) {
             channel_ = std::make_unique<Channel>(std::move(result.value()));
+
+            // Broadcast channels need a cursor of our own
+            if (!channel_->ring_buffer()->attach_consumer(channel_->header(),
+                                                          Handshake::process_id())) {
+                channel_.reset();
+                open_error_ = ErrorCode::ResourceBusy;
+            }
         }
 
         stats_ = {};
+
+        // Only overwrite mode copies messages out (the producer may lap us)
+        if (channel_ && has_flag(channel_->header()->flags, ChannelFlags::Overwrite)) {
+            scratch_.resize(config.max_message_size);
+        }
     }
 
     ~Impl() {
         stop();
+
+        if (channel_) {
+            channel_->ring_buffer()->detach_consumer();
+
+            // A sender waiting on our cursor may now have space
+            if (channel_->ring_buffer()->blocking()) {
+                channel_->ring_buffer()->wake_producers(channel_->header());
+            }
+        }
     }
 
     Result<void> start(MessageHandler handler) {
-        if (!channel_ || !channel_->is_open()) {
-            return Result<void>(ErrorCode::ChannelNotFound);
+        auto entered = enter_run();
+        if (entered.is_error()) {
+            return entered;
         }
 
-        running_.store(true, std::memory_order_release);
-
-        // Message buffer (reuse to avoid allocations)
-        std::vector<uint8_t> buffer(config_.max_message_size);
-
         while (running_.load(std::memory_order_acquire)) {
-            size_t size = buffer.size();
+            const size_t count = consume(MAX_BATCH, [&](std::span<const uint8_t> payload) {
+                handler(payload.data(), payload.size());
+            });
 
-            if (channel_->ring_buffer()->try_read(buffer.data(), size, channel_->header())) {
-                // Successfully read a message
-                handler(buffer.data(), size);
-                stats_.messages_received++;
-                stats_.bytes_received += size;
+            if (count == 0) {
+                idle();  // No messages available
             } else {
-                // No messages available, yield CPU
-                std::this_thread::yield();
-                // Or use a short sleep: std::this_thread::sleep_for(std::chrono::microseconds(10));
+                waiter_.progress();
             }
         }
 
         return Result<void>();
     }
 
+    void channel_empty() {
+        arm_notification();
+    }
+
+    // Shared by start() and Receiver::run()
+    Result<void> enter_run() {
+        if (!channel_ || !channel_->is_open()) {
+            return Result<void>(open_error_);
+        }
+        running_.store(true, std::memory_order_release);
+        return Result<void>();
+    }
+
+    // Wait as the configured strategy says, until data or stop()
+    void idle() {
+        wait_for_data(0, [this] { return !running_.load(std::memory_order_acquire); });
+    }
+
+    void made_progress() noexcept {
+        waiter_.progress();
+    }
+
+    ErrorCode open_error() const noexcept {
+        return open_error_;
+    }
+
+    // The open channel, or null
+    Channel* channel() noexcept {
+        return channel_.get();
+    }
+
     Result<void> start_async(MessageHandler handler) {
         if (worker_thread_.joinable()) {
             return Result<void>(ErrorCode::InvalidOperation);
@@ -71,6 +131,11 @@ public:
     void stop() {
         running_.store(false, std::memory_order_release);
 
+        // A parked start() loop only notices once woken
+        if (channel_ && channel_->ring_buffer()->blocking()) {
+            channel_->ring_buffer()->wake_consumers(channel_->header());
+        }
+
         if (worker_thread_.joinable()) {
             worker_thread_.join();
         }
@@ -82,20 +147,185 @@ public:
 
     Result<bool> poll_one(MessageHandler handler) {
         if (!channel_ || !channel_->is_open()) {
-            return Result<bool>(ErrorCode::ChannelNotFound);
+            return Result<bool>(open_error_);
         }
 
-        std::vector<uint8_t> buffer(config_.max_message_size);
-        size_t size = buffer.size();
+        auto* rb = channel_->ring_buffer();
+        auto* header = channel_->header();
+        std::span<const uint8_t> payload;
+        const uint64_t mismatches = rb->checksum_mismatches();
+        bool received = false;
+
+        if (rb->overwrites()) {
+            received = consume(1, [&](std::span<const uint8_t> copy) {
+                handler(copy.data(), copy.size());
+            }) != 0;
+        } else {
+            rb->release(header);  // Whatever next() still holds
+            if (rb->try_peek(payload, header)) {
+                handler(payload.data(), payload.size());
+                rb->release(header);
+                stats_.messages_received++;
+                stats_.bytes_received += payload.size();
+                received = true;
+            }
+        }
 
-        if (channel_->ring_buffer()->try_read(buffer.data(), size, channel_->header())) {
-            handler(buffer.data(), size);
-            stats_.messages_received++;
-            stats_.bytes_received += size;
-            return Result<bool>(true);
+        if (!received) {
+            arm_notification();
         }
 
-        return Result<bool>(false);
+        // Nothing delivered because a corrupted message was dropped
+        if (!received && rb->checksum_mismatches() != mismatches) {
+            return Result<bool>(ErrorCode::ChecksumMismatch);
+        }
+
+        return Result<bool>(bool{received});
+    }
+
+    Result<bool> receive(MessageHandler handler) {
+        if (!channel_ || !channel_->is_open()) {
+            return Result<bool>(open_error_);
+        }
+
+        const uint64_t timeout_ns = config_.timeout_us * 1000;
+        const uint64_t deadline = steady_now_ns() + timeout_ns;
+
+        for (;;) {
+            auto result = poll_one(handler);
+            if (result.is_error() || result.value()) {
+                waiter_.progress();
+                return result;
+            }
+
+            uint64_t remaining = 0;
+            if (timeout_ns != 0) {
+                const uint64_t now = steady_now_ns();
+                if (now >= deadline) {
+                    return Result<bool>(false);  // Timed out
+                }
+                remaining = deadline - now;
+            }
+            wait_for_data(remaining, [] { return false; });
+        }
+    }
+
+    Result<size_t> drain(size_t max_messages, MessageHandler handler) {
+        if (!channel_ || !channel_->is_open()) {
+            return Result<size_t>(open_error_);
+        }
+
+        const size_t count = consume(max_messages, [&](std::span<const uint8_t> payload) {
+            handler(payload.data(), payload.size());
+        });
+        if (count < max_messages) {
+            arm_notification();
+        }
+        return Result<size_t>(size_t{count});
+    }
+
+    Result<size_t> drain_batch(size_t max_messages, BatchHandler handler) {
+        if (!channel_ || !channel_->is_open()) {
+            return Result<size_t>(open_error_);
+        }
+
+        collect_batch(max_messages);
+        if (!batch_.empty()) {
+            handler(std::span<const MessageView>(batch_));
+        }
+        if (!channel_->ring_buffer()->overwrites()) {
+            channel_->ring_buffer()->release(channel_->header());
+        }
+        if (batch_.size() < max_messages) {
+            arm_notification();
+        }
+        return Result<size_t>(batch_.size());
+    }
+
+    // Receiver::next(): take one message, held in the ring until the next
+    // receive call (overwrite channels copy it, as consume does)
+    bool take_next(MessageView& view) {
+        auto* rb = channel_->ring_buffer();
+        auto* header = channel_->header();
+        bool taken = false;
+
+        if (rb->overwrites()) {
+            taken = consume(1, [&](std::span<const uint8_t> copy) {
+                view = MessageView{copy.data(), copy.size()};
+            }) != 0;
+        } else {
+            std::span<const uint8_t> payload;
+            rb->release(header);
+            taken = rb->try_peek(payload, header);
+            if (taken) {
+                view = MessageView{payload.data(), payload.size()};
+                stats_.messages_received++;
+                stats_.bytes_received += payload.size();
+            }
+        }
+
+        if (!taken) {
+            arm_notification();
+        }
+        return taken;
+    }
+
+    // Receiver::next_batch(): like take_next, for up to max_messages
+    bool take_next_batch(size_t max_messages, std::span<const MessageView>& views) {
+        collect_batch(max_messages);
+        if (batch_.empty()) {
+            arm_notification();
+            return false;
+        }
+        views = std::span<const MessageView>(batch_);
+        return true;
+    }
+
+    // Wait for data with no deadline (next() outside an Executor)
+    void await_data() {
+        wait_for_data(0, [] { return false; });
+    }
+
+    int native_handle() {
+        if (notify_.is_open()) {
+            return notify_.handle();
+        }
+        if (!channel_ || !has_flag(channel_->header()->flags, ChannelFlags::NotifyFd)) {
+            return -1;
+        }
+        if (notify_.open(channel_name_).is_error()) {
+            return -1;
+        }
+
+        // Producers holding an older receiver's fd fetch ours instead, and
+        // take it only from this process
+        std::atomic_ref<uint32_t>(channel_->header()->receiver_pid)
+            .store(Handshake::process_id(), std::memory_order_relaxed);
+        channel_->header()->notify_generation.fetch_add(1, std::memory_order_release);
+        arm_notification();
+        return notify_.handle();
+    }
+
+    Result<size_t> dispatch(size_t max_messages, Dispatcher& dispatcher) {
+        if (!channel_ || !channel_->is_open()) {
+            return Result<size_t>(open_error_);
+        }
+
+        auto* rb = channel_->ring_buffer();
+        const size_t count = consume(max_messages, [&](std::span<const uint8_t> payload) {
+            dispatcher.dispatch(rb->last_type_id(), payload.data(), payload.size());
+        });
+        if (count < max_messages) {
+            arm_notification();
+        }
+        return Result<size_t>(size_t{count});
+    }
+
+    uint64_t last_timestamp_ns() const noexcept {
+        if (!channel_) {
+            return 0;
+        }
+        return to_steady_ns(channel_->header(), channel_->ring_buffer()->last_timestamp());
     }
 
     const std::string& channel_name() const noexcept {
@@ -103,22 +333,154 @@ public:
     }
 
     Receiver::Stats get_stats() const noexcept {
-        return stats_;
+        Receiver::Stats stats = stats_;
+        if (channel_) {
+            stats.overruns = channel_->ring_buffer()->overruns();
+            stats.checksum_mismatches = channel_->ring_buffer()->checksum_mismatches();
+        }
+        return stats;
     }
 
 private:
+    // Fill batch_ with up to max_messages
+    // Views point into the ring and stay there until the next release(); in
+    // overwrite mode they point at copies instead, since the sender may
+    // overwrite the ring at any time.
+    void collect_batch(size_t max_messages) {
+        auto* rb = channel_->ring_buffer();
+        auto* header = channel_->header();
+        batch_.clear();
+
+        if (rb->overwrites()) {
+            copied_.clear();
+            consume(max_messages, [&](std::span<const uint8_t> payload) {
+                copied_.insert(copied_.end(), payload.begin(), payload.end());
+                batch_.push_back(MessageView{nullptr, payload.size()});
+            });
+
+            const uint8_t* data = copied_.data();
+            for (auto& view : batch_) {
+                view.data = data;
+                data += view.size;
+            }
+            return;
+        }
+
+        size_t bytes = 0;
+        rb->release(header);  // Whatever next() still holds
+        rb->peek_batch(max_messages, [&](std::span<const uint8_t> payload) {
+            batch_.push_back(MessageView{payload.data(), payload.size()});
+            bytes += payload.size();
+        }, header);
+
+        stats_.messages_received += batch_.size();
+        stats_.bytes_received += bytes;
+    }
+
+    // Hand up to max_messages to fn and consume them; returns the count
+    // Normally fn sees the ring itself and read_index is published once.
+    // Overwrite channels copy each message out first, since the sender may
+    // reuse a record while fn still looks at it.
+    template<typename Fn>
+    size_t consume(size_t max_messages, Fn&& fn) {
+        auto* rb = channel_->ring_buffer();
+        auto* header = channel_->header();
+
+        size_t count = 0;
+        size_t bytes = 0;
+
+        if (!rb->overwrites()) {
+            rb->release(header);  // Whatever next() still holds
+            count = rb->read_batch(max_messages, [&](std::span<const uint8_t> payload) {
+                fn(payload);
+                bytes += payload.size();
+            }, header);
+        } else {
+            while (count < max_messages) {
+                size_t size = scratch_.size();
+                if (!rb->try_read(scratch_.data(), size, header)) {
+                    if (size > scratch_.size()) {
+                        scratch_.resize(size);  // Larger than any message so far
+                        continue;
+                    }
+                    break;
+                }
+
+                fn(std::span<const uint8_t>(scratch_.data(), size));
+                bytes += size;
+                ++count;
+            }
+        }
+
+        stats_.messages_received += count;
+        stats_.bytes_received += bytes;
+        return count;
+    }
+
+    // One idle round of up to timeout_ns (0 = no limit) waiting for data
+    // Parking uses the futex on BlockingWait channels and yields on others.
+    // May return without data; callers re-check.
+    template<typename Interrupted>
+    void wait_for_data(uint64_t timeout_ns, Interrupted&& interrupted) {
+        auto* rb = channel_->ring_buffer();
+        auto* header = channel_->header();
+
+        waiter_.idle(timeout_ns, &header->write_index,
+            [&] { return rb->readable(header) || interrupted(); },
+            [&](uint64_t park_ns) {
+                if (rb->blocking()) {
+                    rb->wait_for_data(header, park_ns, interrupted);
+                } else {
+                    std::this_thread::yield();
+                }
+            });
+    }
+
+    // Called when a receive call has emptied the channel: ask producers to
+    // signal the eventfd on their next publish (native_handle() users only)
+    // Serving pending fd requests first also resets the eventfd. A publish
+    // that raced with arming is caught by the re-check (pairs with the
+    // fence in RingBuffer::notify_consumers).
+    void arm_notification() {
+        if (!notify_.is_open()) {
+            return;
+        }
+        auto* header = channel_->header();
+
+        notify_.serve();
+        header->notify_armed.store(1, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (channel_->ring_buffer()->readable(header)) {
+            notify_.signal();
+        }
+    }
+
+    // Messages handled per read_index publish in start()
+    static constexpr size_t MAX_BATCH = 256;
+
     std::string channel_name_;
     ChannelConfig config_;
     std::unique_ptr<Channel> channel_;
+    ErrorCode open_error_ = ErrorCode::ChannelNotFound;  // Why channel_ is null
     std::atomic<bool> running_;
     std::thread worker_thread_;
+    Waiter waiter_;  // Used only by the thread that receives
+    NotifyListener notify_;  // Opened by native_handle()
     Receiver::Stats stats_;
+    std::vector<MessageView> batch_;  // Reused by drain_batch
+    std::vector<uint8_t> scratch_;    // Copy target in overwrite mode
+    std::vector<uint8_t> copied_;     // drain_batch payloads in overwrite mode
 };
 
 // Receiver public API implementation
 Receiver::Receiver(const std::string& channel_name, const ChannelConfig& config)
     : impl_(std::make_unique<Impl>(channel_name, config))
-{}
+{
+    if (Channel* channel = impl_->channel()) {
+        ring_ = channel->ring_buffer();
+        header_ = channel->header();
+    }
+}
 
 Receiver::~Receiver() = default;
 
@@ -142,12 +504,71 @@ Result<bool> Receiver::poll_one(MessageHandler handler) {
     return impl_->poll_one(std::move(handler));
 }
 
+Result<bool> Receiver::receive(MessageHandler handler) {
+    return impl_->receive(std::move(handler));
+}
+
+Result<size_t> Receiver::drain(size_t max_messages, MessageHandler handler) {
+    return impl_->drain(max_messages, std::move(handler));
+}
+
+Result<size_t> Receiver::drain_batch(size_t max_messages, BatchHandler handler) {
+    return impl_->drain_batch(max_messages, std::move(handler));
+}
+
+Result<size_t> Receiver::dispatch(size_t max_messages, Dispatcher& dispatcher) {
+    return impl_->dispatch(max_messages, dispatcher);
+}
+
+int Receiver::native_handle() {
+    return impl_->native_handle();
+}
+
+uint64_t Receiver::last_timestamp_ns() const noexcept {
+    return impl_->last_timestamp_ns();
+}
+
 const std::string& Receiver::channel_name() const noexcept {
     return impl_->channel_name();
 }
 
 Receiver::Stats Receiver::get_stats() const noexcept {
-    return impl_->get_stats();
+    Receiver::Stats stats = impl_->get_stats();
+    stats.messages_received += inline_messages_;
+    stats.bytes_received += inline_bytes_;
+    return stats;
+}
+
+ErrorCode Receiver::open_error() const noexcept {
+    return impl_->open_error();
+}
+
+Result<void> Receiver::enter_run() {
+    return impl_->enter_run();
+}
+
+void Receiver::idle() {
+    impl_->idle();
+}
+
+void Receiver::made_progress() noexcept {
+    impl_->made_progress();
+}
+
+void Receiver::channel_empty() {
+    impl_->channel_empty();
+}
+
+bool Receiver::take_next(MessageView& view) {
+    return impl_->take_next(view);
+}
+
+bool Receiver::take_next_batch(size_t max_messages, std::span<const MessageView>& views) {
+    return impl_->take_next_batch(max_messages, views);
+}
+
+void Receiver::await_data() {
+    impl_->await_data();
 }
 
 } // namespace swiftchannel
@@ -2,6 +2,10 @@
 #include "../ipc/shared_memory.hpp"
 #include "../ipc/handshake.hpp"
 #include "swiftchannel/common/alignment.hpp"
+#include "swiftchannel/common/timestamp.hpp"
+
+#include <cstring>
+#include <utility>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -25,10 +29,43 @@ Channel::Channel(std::string name, ChannelConfig config,
     header_ = static_cast<SharedMemoryHeader*>(shared_memory_);
 
     // Ring buffer starts after the header (aligned)
-    uint8_t* ring_buffer_start = static_cast<uint8_t*>(shared_memory_) +
-                                  align_up(sizeof(SharedMemoryHeader), CACHE_LINE_SIZE);
+    // The ring's mode comes from whoever created the channel
+    ring_buffer_ = std::make_unique<RingBuffer>(ring_memory(), config_.ring_buffer_size,
+                                                header_->flags);
+
+    // Producers signal the receiver's eventfd once it is waiting
+    if (has_flag(header_->flags, ChannelFlags::NotifyFd)) {
+        notifier_ = std::make_unique<NotifySender>(
+            name_, header_->notify_generation.load(std::memory_order_acquire));
+        ring_buffer_->set_notifier(notifier_.get());
+    }
+}
 
-    ring_buffer_ = std::make_unique<RingBuffer>(ring_buffer_start, config_.ring_buffer_size);
+Channel::Channel(Channel&& other) noexcept
+    : name_(std::move(other.name_))
+    , config_(other.config_)
+    , shared_memory_(std::exchange(other.shared_memory_, nullptr))
+    , total_size_(std::exchange(other.total_size_, 0))
+    , header_(std::exchange(other.header_, nullptr))
+    , ring_buffer_(std::move(other.ring_buffer_))
+    , notifier_(std::move(other.notifier_))
+    , platform_handle_(std::exchange(other.platform_handle_, nullptr))
+{}
+
+Channel& Channel::operator=(Channel&& other) noexcept {
+    if (this != &other) {
+        close();
+
+        name_ = std::move(other.name_);
+        config_ = other.config_;
+        shared_memory_ = std::exchange(other.shared_memory_, nullptr);
+        total_size_ = std::exchange(other.total_size_, 0);
+        header_ = std::exchange(other.header_, nullptr);
+        ring_buffer_ = std::move(other.ring_buffer_);
+        notifier_ = std::move(other.notifier_);
+        platform_handle_ = std::exchange(other.platform_handle_, nullptr);
+    }
+    return *this;
 }
 
 Result<Channel> Channel::open(const std::string& name, const ChannelConfig& config) noexcept {
@@ -40,8 +77,15 @@ Result<Channel> Channel::open(const std::string& name, const ChannelConfig& conf
     size_t header_size = align_up(sizeof(SharedMemoryHeader), CACHE_LINE_SIZE);
     size_t total_size = header_size + config.ring_buffer_size;
 
+    MappingOptions options;
+    options.huge_pages = config.huge_pages;
+    options.prefault = config.prefault;
+    options.lock = config.lock_memory;
+    options.numa_policy = config.numa_policy;
+    options.numa_node = config.numa_node;
+
     // Try to create or open shared memory
-    auto shm_result = SharedMemory::create_or_open(name, total_size, true);
+    auto shm_result = SharedMemory::create_or_open(name, total_size, true, options);
 
     if (shm_result.is_error()) {
         return Result<Channel>(shm_result.error());
@@ -49,33 +93,59 @@ Result<Channel> Channel::open(const std::string& name, const ChannelConfig& conf
 
     auto shm = std::move(shm_result.value());
     void* memory = shm.data();
-    void* platform_handle = nullptr;
-
-    // Extract platform handle before moving shm
-#ifdef _WIN32
-    // On Windows, we need to duplicate the handle or extract it
-    // For simplicity, we'll manage it through a helper
-    platform_handle = shm.data();  // Placeholder - will be handled in platform code
-#else
-    // On POSIX, extract the fd
-    platform_handle = reinterpret_cast<void*>(static_cast<intptr_t>(-1));
-#endif
+    total_size = shm.size();  // Rounded up to whole huge pages
 
     // Get header pointer
     auto* header = static_cast<SharedMemoryHeader*>(memory);
 
-    // Check if we need to initialize
-    bool needs_init = (header->magic != SharedMemoryHeader::MAGIC);
+    // Exactly one opener initializes a new channel; the others wait until it
+    // has published the header
+    const bool needs_init = Handshake::claim_header(header);
 
     if (needs_init) {
+        uint64_t flags = config.channel_flags();
+
+        // TSC stamps need a TSC that every core runs at the same constant
+        // rate; otherwise fall back to steady_clock
+        TscCalibration calibration{};
+        if (has_flag(flags, ChannelFlags::TscTimestamp)) {
+            if (tsc_is_invariant()) {
+                calibration = calibrate_tsc();
+            } else {
+                flags &= ~static_cast<uint64_t>(ChannelFlags::TscTimestamp);
+            }
+        }
+
+        // Multi-producer rings detect committed records by their magic word,
+        // so stale contents from an earlier channel must not survive. A new
+        // segment is already zero-filled; this covers a reused one, and must
+        // finish before the header lets any producer in.
+        if (has_flag(flags, ChannelFlags::MultiProducer)) {
+            std::memset(static_cast<uint8_t*>(memory) + header_size, 0, config.ring_buffer_size);
+        }
+
         // Initialize header
-        Handshake::initialize_header(header, config.ring_buffer_size, config.flags);
+        Handshake::initialize_header(header, config.ring_buffer_size, flags, config.slot_size);
+        header->tsc = calibration;
+        Handshake::publish_header(header);
     } else {
+        auto published = Handshake::wait_published(header);
+        if (published.is_error()) {
+            return Result<Channel>(published.error());
+        }
+
         // Validate existing header
         auto validate_result = Handshake::validate_header(header);
         if (validate_result.is_error()) {
             return Result<Channel>(validate_result.error());
         }
+
+        // Both sides index the ring with the same mask, and typed and byte
+        // channels (or typed channels of different T) do not mix
+        if (header->ring_buffer_size != config.ring_buffer_size ||
+            header->slot_size != config.slot_size) {
+            return Result<Channel>(ErrorCode::InvalidMemoryLayout);
+        }
     }
 
     // Perform sender handshake
@@ -84,6 +154,10 @@ Result<Channel> Channel::open(const std::string& name, const ChannelConfig& conf
         return Result<Channel>(handshake_result.error());
     }
 
+    // The channel takes over the mapping and the platform handle (until
+    // here, shm unmaps it again on failure)
+    void* platform_handle = shm.release();
+
     // Create channel
     return Result<Channel>(Channel(name, config, memory, total_size, platform_handle));
 }
@@ -114,6 +188,7 @@ void Channel::close() noexcept {
 
     header_ = nullptr;
     ring_buffer_.reset();
+    notifier_.reset();
 }
 
 } // namespace swiftchannel
@@ -1,13 +1,61 @@
 #include <swiftchannel/swiftchannel.hpp>
 #include <swiftchannel/receiver/receiver.hpp>
+#include <swiftchannel/receiver/channel_set.hpp>
+#include <swiftchannel/receiver/handler_pool.hpp>
 #include <iostream>
 #include <thread>
 #include <chrono>
 #include <atomic>
 #include <cassert>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/mman.h>
+#endif
 
 using namespace swiftchannel;
 
+namespace {
+
+// Coroutine flows for the executor phase
+Task<int> sum_messages(Receiver& receiver, int count) {
+    int sum = 0;
+    for (int i = 0; i < count; ++i) {
+        auto view = co_await receiver.next();
+        if (view.is_error()) {
+            co_return -1;
+        }
+        int sequence = 0;
+        std::memcpy(&sequence, view.value().data, sizeof(sequence));
+        sum += sequence;
+    }
+    co_return sum;
+}
+
+Task<void> consume_flow(Receiver& receiver, int count, int& sum) {
+    sum = co_await sum_messages(receiver, count);
+}
+
+Task<void> batch_flow(Receiver& receiver, int count, int& batches) {
+    for (int seen = 0; seen < count; ++batches) {
+        auto views = co_await receiver.next_batch(64);
+        seen += views.is_ok() ? static_cast<int>(views.value().size()) : count;
+    }
+}
+
+Task<void> produce_flow(Sender& sender, int count, bool& all_sent) {
+    for (int i = 1; i <= count; ++i) {
+        auto sent = co_await sender.async_send(i);
+        all_sent = all_sent && sent.is_ok();
+    }
+}
+
+} // namespace
+
 struct TestData {
     int sequence;
     double timestamp;
@@ -24,6 +72,8 @@ int main() {
 
     std::atomic<int> messages_received{0};
     std::atomic<bool> receiver_ready{false};
+    std::mutex received_mutex;
+    std::vector<TestData> received_messages;
 
     // Start receiver in a separate thread
     std::thread receiver_thread([&]() {
@@ -35,6 +85,10 @@ int main() {
             const TestData* msg = static_cast<const TestData*>(data);
             std::cout << "  Received message #" << msg->sequence
                      << " with payload: " << msg->payload << "\n";
+            {
+                std::lock_guard<std::mutex> lock(received_mutex);
+                received_messages.push_back(*msg);
+            }
             messages_received.fetch_add(1);
         };
 
@@ -53,6 +107,9 @@ int main() {
     std::this_thread::sleep_for(std::chrono::milliseconds(100));
 
     // Send messages
+    const int num_messages = 10;
+    size_t batch_sent = 0;
+    bool emplaced = false;
     {
         Sender sender(channel_name, config);
 
@@ -62,7 +119,6 @@ int main() {
             return 1;
         }
 
-        const int num_messages = 10;
         for (int i = 0; i < num_messages; ++i) {
             TestData msg;
             msg.sequence = i;
@@ -80,15 +136,551 @@ int main() {
 
             std::this_thread::sleep_for(std::chrono::milliseconds(50));
         }
+
+        // Send a burst with a single publish
+        TestData batch[5];
+        for (int i = 0; i < 5; ++i) {
+            batch[i].sequence = num_messages + i;
+            batch[i].timestamp = 0.0;
+            snprintf(batch[i].payload, sizeof(batch[i].payload), "Batch_%d", i);
+        }
+
+        auto batch_result = sender.send_batch(batch);
+        if (batch_result.is_ok()) {
+            batch_sent = batch_result.value();
+            std::cout << "  Sent batch of " << batch_sent << " messages\n";
+        } else {
+            std::cerr << "  Failed to send batch, error: "
+                     << static_cast<int>(batch_result.error()) << "\n";
+        }
+
+        // Construct one message directly in the ring
+        auto emplace_result = sender.emplace<TestData>(
+            TestData{num_messages + 5, 0.0, "Emplaced"});
+        emplaced = emplace_result.is_ok();
+        if (!emplaced) {
+            std::cerr << "  Failed to emplace message, error: "
+                     << static_cast<int>(emplace_result.error()) << "\n";
+        }
     }
 
     // Wait for receiver to finish
     receiver_thread.join();
 
+    // The single sends, the batch and the emplaced message arrive once each,
+    // in order and intact
+    bool batch_ok = batch_sent == 5 && emplaced &&
+                    received_messages.size() == static_cast<size_t>(num_messages + 6);
+    for (size_t i = 0; batch_ok && i < received_messages.size(); ++i) {
+        const int index = static_cast<int>(i);
+        std::string expected = "Emplaced";
+        if (index < num_messages) {
+            expected = "Message_" + std::to_string(index);
+        } else if (index < num_messages + 5) {
+            expected = "Batch_" + std::to_string(index - num_messages);
+        }
+        batch_ok = received_messages[i].sequence == index &&
+                   expected == received_messages[i].payload;
+    }
+    std::cout << "  Batched and emplaced sends " << (batch_ok ? "ok" : "failed") << "\n";
+
+    // Drain a backlog from the current thread
+    int drained = 0;
+    {
+        const std::string drain_channel = "test_channel_drain";
+        Receiver receiver(drain_channel, config);
+        Sender sender(drain_channel, config);
+
+        // Skip anything left over from a previous run
+        while (receiver.drain(1024, [](const void*, size_t) {}).value_or(0) != 0) {}
+
+        std::vector<TestData> batch(20);
+        for (int i = 0; i < 20; ++i) {
+            batch[i].sequence = i;
+        }
+        auto batch_result = sender.send_batch(batch);
+        (void)batch_result; // Mark as used
+
+        auto first = receiver.drain(8, [&](const void* data, size_t) {
+            if (static_cast<const TestData*>(data)->sequence == drained) {
+                drained++;
+            }
+        });
+
+        auto rest = receiver.drain_batch(100, [&](std::span<const MessageView> messages) {
+            for (const auto& message : messages) {
+                if (static_cast<const TestData*>(message.data)->sequence == drained) {
+                    drained++;
+                }
+            }
+        });
+
+        std::cout << "  Drained " << first.value_or(0) << " + "
+                  << rest.value_or(0) << " messages\n";
+    }
+
+    // Overwrite mode: a sender that outruns the receiver keeps the newest data
+    bool overwrite_ok = false;
+    {
+        const std::string overwrite_channel = "test_channel_overwrite";
+        ChannelConfig overwrite_config = config;
+        overwrite_config.ring_buffer_size = 4096;
+        overwrite_config.max_message_size = 256;
+        overwrite_config.overwrite_on_full = true;
+
+        Receiver receiver(overwrite_channel, overwrite_config);
+        Sender sender(overwrite_channel, overwrite_config);
+
+        // Skip anything left over from a previous run
+        while (receiver.drain(1024, [](const void*, size_t) {}).value_or(0) != 0) {}
+
+        constexpr int total = 1000;
+        bool all_sent = true;
+        for (int i = 0; i < total; ++i) {
+            TestData data{};
+            data.sequence = i;
+            all_sent = sender.send(data).is_ok() && all_sent;
+        }
+
+        int next = -1;
+        bool in_order = true;
+        auto kept = receiver.drain_batch(total, [&](std::span<const MessageView> messages) {
+            for (const auto& message : messages) {
+                const int sequence = static_cast<const TestData*>(message.data)->sequence;
+                in_order = in_order && (next < 0 || sequence == next);
+                next = sequence + 1;
+            }
+        });
+
+        const auto stats = receiver.get_stats();
+        std::cout << "  Overwrite mode kept " << kept.value_or(0) << " of " << total
+                  << " messages (" << stats.overruns << " overruns)\n";
+
+        overwrite_ok = all_sent && in_order && next == total && stats.overruns > 0;
+    }
+
+    // Huge-page backed, pre-faulted channel (falls back to normal pages)
+    bool huge_pages_ok = false;
+    {
+        const std::string huge_channel = "test_channel_huge_pages";
+        ChannelConfig huge_config = config;
+        huge_config.huge_pages = true;
+        huge_config.prefault = true;
+
+        Receiver receiver(huge_channel, huge_config);
+        Sender sender(huge_channel, huge_config);
+
+        // Skip anything left over from a previous run
+        while (receiver.drain(1024, [](const void*, size_t) {}).value_or(0) != 0) {}
+
+        TestData data{};
+        data.sequence = 42;
+        const bool sent = sender.send(data).is_ok();
+
+        int received = -1;
+        auto count = receiver.drain(1, [&](const void* message, size_t) {
+            received = static_cast<const TestData*>(message)->sequence;
+        });
+
+        huge_pages_ok = sent && count.value_or(0) == 1 && received == 42;
+        std::cout << "  Huge page channel " << (huge_pages_ok ? "ok" : "failed") << "\n";
+    }
+
+    // Flags this version does not know are refused
+    bool unknown_flags_ok = false;
+    {
+        ChannelConfig unknown_config = config;
+        unknown_config.flags |= KNOWN_CHANNEL_FLAGS + 1;
+
+        Sender sender("test_channel_unknown_flags", unknown_config);
+        unknown_flags_ok = !unknown_config.is_valid() && !sender.is_ready();
+        std::cout << "  Unknown flags " << (unknown_flags_ok ? "refused" : "accepted") << "\n";
+    }
+
+    // Openers racing for a new channel: one initializes it (calibrating the
+    // TSC on the way), the others wait and keep what it set up
+    bool init_race_ok = true;
+#if defined(__linux__)
+    {
+        const std::string race_channel = "test_channel_init_race";
+        ::shm_unlink(("/swiftchannel_" + race_channel).c_str());
+
+        ChannelConfig race_config = config;
+        race_config.timestamp_source = TimestampSource::Tsc;
+
+        constexpr int openers = 4;
+        std::atomic<int> ready{0};
+        std::atomic<int> sent{0};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < openers; ++i) {
+            threads.emplace_back([&, i] {
+                ++ready;
+                while (ready.load() < openers) {}
+                Sender sender(race_channel, race_config);
+                TestData data{};
+                data.sequence = i;
+                if (sender.is_ready() && sender.send(data).is_ok()) {
+                    ++sent;
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        Receiver receiver(race_channel, race_config);
+        auto count = receiver.drain(16, [](const void*, size_t) {});
+        init_race_ok = sent.load() == openers && count.value_or(0) == openers;
+        std::cout << "  Concurrent openers " << (init_race_ok ? "ok" : "failed") << "\n";
+    }
+#endif
+
+    // Blocking receive: parks until the sender wakes it, or times out
+    bool blocking_ok = false;
+    {
+        const std::string blocking_channel = "test_channel_blocking";
+        ChannelConfig blocking_config = config;
+        blocking_config.blocking_wait = true;
+        blocking_config.timeout_us = 20000;  // 20 ms
+
+        Receiver receiver(blocking_channel, blocking_config);
+        Sender sender(blocking_channel, blocking_config);
+
+        // Skip anything left over from a previous run
+        while (receiver.drain(1024, [](const void*, size_t) {}).value_or(0) != 0) {}
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool timed_out = !receiver.receive([](const void*, size_t) {}).value_or(true);
+        const auto waited = std::chrono::steady_clock::now() - start;
+
+        std::thread late_sender([&sender] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            TestData data{};
+            data.sequence = 7;
+            [[maybe_unused]] auto result = sender.send(data);
+        });
+
+        int received = -1;
+        const bool woken = receiver.receive([&](const void* message, size_t) {
+            received = static_cast<const TestData*>(message)->sequence;
+        }).value_or(false);
+        late_sender.join();
+
+        blocking_ok = timed_out && waited >= std::chrono::milliseconds(20) &&
+                      woken && received == 7;
+        std::cout << "  Blocking receive " << (blocking_ok ? "ok" : "failed") << "\n";
+    }
+
+    // Backpressure: a full channel makes send_for time out and send_blocking
+    // wait until the receiver frees space
+    bool backpressure_ok = false;
+    {
+        const std::string full_channel = "test_channel_backpressure";
+        ChannelConfig full_config = config;
+        full_config.ring_buffer_size = 4096;
+        full_config.max_message_size = 256;
+        full_config.blocking_wait = true;
+
+        Receiver receiver(full_channel, full_config);
+        Sender sender(full_channel, full_config);
+        while (receiver.drain(1024, [](const void*, size_t) {}).value_or(0) != 0) {}
+
+        TestData data{};
+        while (sender.send(data).is_ok()) {}
+
+        const bool timed_out = sender.send_for(data, std::chrono::milliseconds(20)).error() ==
+                               ErrorCode::ChannelFull;
+
+        std::thread late_receiver([&receiver] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            [[maybe_unused]] auto count = receiver.drain(1, [](const void*, size_t) {});
+        });
+        data.sequence = 11;
+        const bool sent = sender.send_blocking(data).is_ok();
+        late_receiver.join();
+
+        const auto stats = sender.get_stats();
+        backpressure_ok = timed_out && sent && stats.stalls == 2 && stats.timeouts == 1 &&
+                          stats.stall_ns >= 20000000 && stats.max_stall_ns <= stats.stall_ns;
+        std::cout << "  Blocking send " << (backpressure_ok ? "ok" : "failed") << "\n";
+    }
+
+    // Inlined receive loops: poll and run see what poll_one and start would
+    bool inline_ok = false;
+    {
+        const std::string inline_channel = "test_channel_inline";
+        Receiver receiver(inline_channel, config);
+        Sender sender(inline_channel, config);
+        while (receiver.drain(1024, [](const void*, size_t) {}).value_or(0) != 0) {}
+
+        TestData data{};
+        for (int i = 1; i <= 4; ++i) {
+            data.sequence = i;
+            [[maybe_unused]] auto result = sender.send(data);
+        }
+
+        int polled = 0;
+        const bool got_one = receiver.poll([&](const void* message, size_t) {
+            polled = static_cast<const TestData*>(message)->sequence;
+        }).value_or(false);
+
+        int sum = 0;
+        auto ran = receiver.run([&](const void* message, size_t) {
+            sum += static_cast<const TestData*>(message)->sequence;
+            if (sum == 2 + 3 + 4) {
+                receiver.stop();
+            }
+        });
+        const bool empty = !receiver.poll([](const void*, size_t) {}).value_or(true);
+
+        inline_ok = got_one && polled == 1 && ran.is_ok() && sum == 9 && empty &&
+                    receiver.get_stats().messages_received >= 4;
+        std::cout << "  Inlined receive " << (inline_ok ? "ok" : "failed") << "\n";
+    }
+
+    // Typed dispatch: each send<T> reaches the handler registered for T
+    bool dispatch_ok = false;
+    {
+        const std::string dispatch_channel = "test_channel_dispatch";
+        Receiver receiver(dispatch_channel, config);
+        Sender sender(dispatch_channel, config);
+        while (receiver.drain(1024, [](const void*, size_t) {}).value_or(0) != 0) {}
+
+        int typed = 0;
+        int unknown = 0;
+        Dispatcher dispatcher;
+        [[maybe_unused]] auto added = dispatcher.on<TestData>([&](const TestData& message) {
+            typed += message.sequence;
+        });
+        dispatcher.on_unknown([&](uint32_t, const void*, size_t) { ++unknown; });
+
+        TestData data{};
+        data.sequence = 5;
+        const bool sent = sender.send(data).is_ok() &&
+                          sender.send_bytes(&data, sizeof(data)).is_ok();
+        const size_t count = receiver.dispatch(16, dispatcher).value_or(0);
+
+        dispatch_ok = sent && count == 2 && typed == 5 && unknown == 1;
+        std::cout << "  Typed dispatch " << (dispatch_ok ? "ok" : "failed") << "\n";
+    }
+
+    // Event-loop receive: the native handle becomes readable when data arrives
+    bool notify_ok = true;
+#if defined(__linux__)
+    {
+        const std::string notify_channel = "test_channel_notify";
+        ChannelConfig notify_config = config;
+        notify_config.notify_fd = true;
+
+        Receiver receiver(notify_channel, notify_config);
+        Sender sender(notify_channel, notify_config);
+        while (receiver.drain(1024, [](const void*, size_t) {}).value_or(0) != 0) {}
+
+        pollfd handle{receiver.native_handle(), POLLIN, 0};
+        const bool idle = handle.fd >= 0 && ::poll(&handle, 1, 20) == 0;
+
+        std::thread late_sender([&sender] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            TestData data{};
+            data.sequence = 9;
+            [[maybe_unused]] auto result = sender.send(data);
+        });
+
+        // One wakeup, with the message already there: the sender asked for
+        // the fd without waiting, and its pending request keeps the handle
+        // readable until the receiver answers it
+        int received = -1;
+        if (::poll(&handle, 1, 1000) == 1) {
+            [[maybe_unused]] auto count = receiver.drain(16, [&](const void* message, size_t) {
+                received = static_cast<const TestData*>(message)->sequence;
+            });
+        }
+        late_sender.join();
+
+        // Drained and re-armed: quiet until the next message
+        const bool quiet = ::poll(&handle, 1, 20) == 0;
+
+        TestData data{};
+        data.sequence = 10;
+        [[maybe_unused]] auto result = sender.send(data);
+        const bool signalled = ::poll(&handle, 1, 1000) == 1;
+
+        notify_ok = idle && received == 9 && quiet && signalled;
+        std::cout << "  Event-loop receive " << (notify_ok ? "ok" : "failed") << "\n";
+    }
+#endif
+
+    // Channel set: weighted budgets per round, and one parked thread that
+    // any channel's sender wakes
+    bool channel_set_ok = false;
+    {
+        ChannelConfig set_config = config;
+        set_config.blocking_wait = true;
+
+        ChannelSetConfig policy;
+        policy.policy = SchedulingPolicy::Weighted;
+        policy.burst = 2;
+        ChannelSet set(policy);
+
+        std::atomic<int> heavy{0};
+        std::atomic<int> light{0};
+        int first = 0;
+        auto heavy_added = set.add("test_channel_set_heavy", [&](const void*, size_t) {
+            first = first != 0 ? first : 1;
+            heavy.fetch_add(1);
+        }, set_config, 3);
+        auto light_added = set.add("test_channel_set_light", [&](const void*, size_t) {
+            first = first != 0 ? first : 2;
+            light.fetch_add(1);
+        }, set_config);
+        Sender heavy_sender("test_channel_set_heavy", set_config);
+        Sender light_sender("test_channel_set_light", set_config);
+        while (set.poll().value_or(0) != 0) {}
+        heavy = 0;
+        light = 0;
+
+        TestData data{};
+        for (int i = 0; i < 10; ++i) {
+            [[maybe_unused]] auto sent_heavy = heavy_sender.send(data);
+            [[maybe_unused]] auto sent_light = light_sender.send(data);
+        }
+        first = 0;
+        const size_t round = set.poll().value_or(0);
+        const bool weighted = round == 8 && heavy == 6 && light == 2 && first == 1;
+        while (set.poll().value_or(0) != 0) {}
+
+        // Idle long enough to park, then wake on the light channel
+        const bool started = set.start_async().is_ok();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        const uint64_t parks = set.get_stats().parks;
+        [[maybe_unused]] auto late = light_sender.send(data);
+        for (int i = 0; i < 1000 && light.load() != 11; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        set.stop();
+
+        channel_set_ok = heavy_added.is_ok() && light_added.is_ok() && set.size() == 2 &&
+                         weighted && started && parks > 0 && light.load() == 11 &&
+                         heavy.load() == 10;
+        std::cout << "  Channel set " << (channel_set_ok ? "ok" : "failed") << "\n";
+    }
+
+    // Handler pool: messages with one key stay in order across threads, and
+    // every view is still intact when its handler runs
+    bool pool_ok = false;
+    {
+        const std::string pool_channel = "test_channel_pool";
+        ChannelConfig pool_config = config;
+        pool_config.blocking_wait = true;
+
+        Receiver receiver(pool_channel, pool_config);
+        Sender sender(pool_channel, pool_config);
+        while (receiver.drain(1024, [](const void*, size_t) {}).value_or(0) != 0) {}
+
+        HandlerPoolConfig pool_settings;
+        pool_settings.threads = 3;
+        pool_settings.max_in_flight = 16;
+        HandlerPool pool(receiver, pool_settings);
+
+        constexpr int keys = 4;
+        constexpr int per_key = 100;
+        std::atomic<int> last[keys] = {};
+        std::atomic<int> handled{0};
+        std::atomic<bool> in_order{true};
+        auto started = pool.start_async([&](const void* message, size_t) {
+            const auto* data = static_cast<const TestData*>(message);
+            const int key = data->sequence % keys;
+            const int previous = last[key].exchange(data->sequence);
+            if (previous > data->sequence || data->payload[0] != 'k') {
+                in_order = false;
+            }
+            handled.fetch_add(1);
+        }, [](const void* message, size_t) -> uint64_t {
+            return static_cast<uint64_t>(static_cast<const TestData*>(message)->sequence % keys);
+        });
+
+        TestData data{};
+        data.payload[0] = 'k';
+        for (int i = 1; i <= keys * per_key; ++i) {
+            data.sequence = i;
+            while (sender.send(data).is_error()) {
+                std::this_thread::yield();
+            }
+        }
+        for (int i = 0; i < 5000 && handled.load() != keys * per_key; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        pool.stop();
+
+        const auto stats = pool.get_stats();
+        pool_ok = started.is_ok() && in_order && handled.load() == keys * per_key &&
+                  stats.dispatched == keys * per_key && stats.handled == stats.dispatched &&
+                  receiver.drain(16, [](const void*, size_t) {}).value_or(1) == 0;
+        std::cout << "  Handler pool " << (pool_ok ? "ok" : "failed") << "\n";
+    }
+
+    // Coroutines: producers suspend on a full ring and consumers on an
+    // empty one, all on one executor thread
+    bool coroutine_ok = false;
+    {
+        ChannelConfig flow_config = config;
+        flow_config.ring_buffer_size = 4096;
+        flow_config.max_message_size = 256;
+        flow_config.blocking_wait = true;
+
+        Receiver receiver("test_channel_flow", flow_config);
+        Receiver batch_receiver("test_channel_flow_batch", flow_config);
+        Sender sender("test_channel_flow", flow_config);
+        Sender batch_sender("test_channel_flow_batch", flow_config);
+        while (receiver.drain(1024, [](const void*, size_t) {}).value_or(0) != 0) {}
+        while (batch_receiver.drain(1024, [](const void*, size_t) {}).value_or(0) != 0) {}
+
+        constexpr int count = 1000;  // Several times what the ring holds
+        int sum = 0;
+        int batches = 0;
+        bool all_sent = true;
+
+        Executor executor;
+        executor.spawn(consume_flow(receiver, count, sum));
+        executor.spawn(batch_flow(batch_receiver, count, batches));
+        executor.spawn(produce_flow(sender, count, all_sent));
+        executor.spawn(produce_flow(batch_sender, count, all_sent));
+        executor.run();
+
+        // A late message from another thread wakes a parked executor
+        Executor waiting;
+        int late_sum = 0;
+        waiting.spawn(consume_flow(receiver, 1, late_sum));
+        std::thread late_sender([&sender] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            [[maybe_unused]] auto result = sender.send(7);
+        });
+        waiting.run();
+        late_sender.join();
+
+        // A stop() made before run() is not lost: run() returns at once
+        Executor stopping;
+        int never = 0;
+        stopping.spawn(consume_flow(receiver, 1, never));
+        stopping.stop();
+        stopping.run();
+        const bool stopped_early = stopping.pending() == 1;
+
+        coroutine_ok = all_sent && sum == count * (count + 1) / 2 && batches > 0 &&
+                       batches < count && late_sum == 7 && executor.pending() == 0 &&
+                       stopped_early;
+        std::cout << "  Coroutine flows " << (coroutine_ok ? "ok" : "failed") << "\n";
+    }
+
     std::cout << "\nTest summary:\n";
     std::cout << "  Messages received: " << messages_received.load() << "\n";
 
-    if (messages_received.load() > 0) {
+    std::cout << "  Messages drained in order: " << drained << "\n";
+
+    if (batch_ok && drained == 20 && overwrite_ok && huge_pages_ok && unknown_flags_ok &&
+        init_race_ok &&
+        blocking_ok && backpressure_ok && inline_ok && dispatch_ok && notify_ok &&
+        channel_set_ok && pool_ok && coroutine_ok) {
         std::cout << "Integration test PASSED!\n";
         return 0;
     } else {
@@ -0,0 +1,76 @@
+#include <swiftchannel/common/checksum.hpp>
+#include <algorithm>
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+using namespace swiftchannel;
+
+// Simple test harness
+int main() {
+    std::cout << "Running checksum tests...\n";
+
+    // Test 1: Known CRC32C values
+    {
+        const char* check = "123456789";
+        assert(crc32c(check, 9) == 0xE3069283u && "Standard CRC32C check value");
+        assert(crc32c(check, 0) == 0);
+
+        // 32 bytes of zeros (RFC 3720, B.4)
+        const uint8_t zeros[32] = {};
+        assert(crc32c(zeros, sizeof(zeros)) == 0x8A9136AAu);
+        (void)check; // Mark as used
+        (void)zeros;
+
+        std::cout << "  [PASS] Known value test passed\n";
+    }
+
+    // Test 2: Hardware, portable and fused-copy paths agree at every length
+    {
+        std::vector<uint8_t> data(300);
+        uint32_t state = 12345;
+        for (auto& byte : data) {
+            state = state * 1103515245u + 12345u;
+            byte = static_cast<uint8_t>(state >> 16);
+        }
+
+        bool match = true;
+        std::vector<uint8_t> copy(data.size());
+        for (size_t offset = 0; offset < 8; ++offset) {
+            for (size_t length = 0; length + offset <= data.size(); length += 7) {
+                const uint8_t* src = data.data() + offset;
+                const uint32_t expected =
+                    ~detail::crc32c_portable<false>(~0u, nullptr, src, length);
+
+                std::fill(copy.begin(), copy.end(), 0);
+                const uint32_t copied = copy_crc32c(copy.data(), src, length);
+
+                match = match && crc32c(src, length) == expected && copied == expected &&
+                        std::memcmp(copy.data(), src, length) == 0;
+            }
+        }
+
+        assert(match && "All CRC32C paths should produce the same value");
+        (void)match; // Mark as used
+
+        std::cout << "  [PASS] Implementation agreement test passed\n";
+    }
+
+    // Test 3: Chaining over split buffers
+    {
+        const char* text = "SwiftChannel checksums can be computed piecewise";
+        const size_t length = std::strlen(text);
+
+        const uint32_t whole = crc32c(text, length);
+        const uint32_t split = crc32c(text + 13, length - 13, crc32c(text, 13));
+        assert(whole == split);
+        (void)whole; // Mark as used
+        (void)split;
+
+        std::cout << "  [PASS] Chaining test passed\n";
+    }
+
+    std::cout << "All checksum tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include <swiftchannel/receiver/dispatcher.hpp>
+#include <swiftchannel/sender/ring_buffer.hpp>
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+using namespace swiftchannel;
+
+struct Quote {
+    uint64_t instrument;
+    double price;
+};
+
+struct Trade {
+    uint64_t instrument;
+    double price;
+    uint32_t quantity;
+};
+
+struct Heartbeat {
+    static constexpr uint32_t swiftchannel_type_id = 0x1001;
+    uint64_t sequence;
+};
+
+template<int N>
+struct Numbered {
+    uint64_t value;
+};
+
+// Simple test harness
+int main() {
+    std::cout << "Running dispatch tests...\n";
+
+    // Test 1: Type ids are constant, distinct, nonzero, and can be pinned
+    {
+        static_assert(type_id_v<Quote> != 0 && type_id_v<Trade> != 0);
+        static_assert(type_id_v<Quote> != type_id_v<Trade>);
+        static_assert(type_id_v<Heartbeat> == 0x1001);
+        static_assert(type_id_v<Numbered<1>> != type_id_v<Numbered<2>>);
+
+        std::cout << "  [PASS] Type id test passed\n";
+    }
+
+    // Test 2: Handlers get const T&; unknown and mis-sized messages do not
+    {
+        Dispatcher dispatcher;
+        double quote_price = 0;
+        uint32_t trade_quantity = 0;
+        uint32_t unknown_id = 0;
+
+        auto quote_added = dispatcher.on<Quote>([&](const Quote& quote) {
+            quote_price = quote.price;
+        });
+        auto trade_added = dispatcher.on<Trade>([&](const Trade& trade) {
+            trade_quantity = trade.quantity;
+        });
+        dispatcher.on_unknown([&](uint32_t type_id, const void*, size_t) {
+            unknown_id = type_id;
+        });
+        assert(quote_added.is_ok() && trade_added.is_ok() && dispatcher.size() == 2);
+        (void)quote_added; // Mark as used
+        (void)trade_added; // Mark as used
+
+        const Quote quote{7, 101.5};
+        const Trade trade{7, 101.25, 300};
+        const bool quote_routed = dispatcher.dispatch(type_id_v<Quote>, &quote, sizeof(quote));
+        const bool trade_routed = dispatcher.dispatch(type_id_v<Trade>, &trade, sizeof(trade));
+        assert(quote_routed && trade_routed);
+        assert(quote_price == 101.5 && trade_quantity == 300);
+        (void)quote_routed; // Mark as used
+        (void)trade_routed; // Mark as used
+
+        const bool heartbeat_routed = dispatcher.dispatch(0x1001, &quote, sizeof(quote));
+        assert(!heartbeat_routed && unknown_id == 0x1001);
+        (void)heartbeat_routed; // Mark as used
+
+        unknown_id = 0;
+        const bool short_routed = dispatcher.dispatch(type_id_v<Trade>, &quote, sizeof(quote));
+        assert(!short_routed && unknown_id == type_id_v<Trade>);
+        (void)short_routed; // Mark as used
+
+        const auto stats = dispatcher.get_stats();
+        assert(stats.dispatched == 2 && stats.unknown == 2);
+        (void)stats; // Mark as used
+
+        std::cout << "  [PASS] Routing test passed\n";
+    }
+
+    // Test 3: The table grows past its first size; re-registering replaces
+    {
+        Dispatcher dispatcher;
+        uint64_t sum = 0;
+        bool all_added = true;
+        auto add = [&]<int... N>(std::integer_sequence<int, N...>) {
+            ((all_added = all_added && dispatcher.on<Numbered<N>>(
+                [&](const Numbered<N>& message) { sum += message.value; }).is_ok()), ...);
+        };
+        add(std::make_integer_sequence<int, 48>{});
+        assert(all_added && dispatcher.size() == 48);
+        (void)all_added; // Mark as used
+
+        const Numbered<0> first{1};
+        const Numbered<47> last{100};
+        dispatcher.dispatch(type_id_v<Numbered<0>>, &first, sizeof(first));
+        dispatcher.dispatch(type_id_v<Numbered<47>>, &last, sizeof(last));
+        assert(sum == 101);
+
+        auto replaced = dispatcher.on<Numbered<0>>([&](const Numbered<0>&) { sum = 0; });
+        dispatcher.dispatch(type_id_v<Numbered<0>>, &first, sizeof(first));
+        assert(replaced.is_ok() && sum == 0 && dispatcher.size() == 48);
+        (void)replaced; // Mark as used
+
+        std::cout << "  [PASS] Table growth test passed\n";
+
+        // Test 3b: A moved-from dispatcher is empty but still usable
+        Dispatcher moved(std::move(dispatcher));
+        moved.dispatch(type_id_v<Numbered<47>>, &last, sizeof(last));
+        assert(sum == 100 && moved.size() == 48);
+
+        const bool stale_routed = dispatcher.dispatch(type_id_v<Numbered<47>>, &last, sizeof(last));
+        assert(!stale_routed && dispatcher.size() == 0 && sum == 100);
+        (void)stale_routed; // Mark as used
+
+        auto readded = dispatcher.on<Numbered<1>>([&](const Numbered<1>& message) {
+            sum += message.value;
+        });
+        const Numbered<1> second{5};
+        const bool readded_routed = dispatcher.dispatch(type_id_v<Numbered<1>>, &second, sizeof(second));
+        assert(readded.is_ok() && readded_routed && sum == 105);
+        (void)readded; // Mark as used
+        (void)readded_routed; // Mark as used
+
+        Dispatcher assigned;
+        assigned = std::move(moved);
+        const bool assigned_routed = moved.dispatch(type_id_v<Numbered<0>>, &first, sizeof(first));
+        assert(!assigned_routed && assigned.size() == 48 && moved.size() == 0);
+        (void)assigned_routed; // Mark as used
+
+        std::cout << "  [PASS] Move test passed\n";
+    }
+
+    // Test 4: Type ids travel in the record header, full and compact
+    {
+        const uint64_t compact = static_cast<uint64_t>(ChannelFlags::CompactFraming);
+        const uint64_t layouts[] = {
+            0,
+            compact | static_cast<uint64_t>(ChannelFlags::TypeIds),
+            compact | static_cast<uint64_t>(ChannelFlags::TypeIds) |
+                static_cast<uint64_t>(ChannelFlags::Checksum),
+        };
+
+        for (uint64_t flags : layouts) {
+            constexpr size_t buffer_size = 4096;
+            alignas(CACHE_LINE_SIZE) uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)] = {};
+
+            auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+            void* ring_memory = memory + sizeof(SharedMemoryHeader);
+            RingBuffer rb(ring_memory, buffer_size, flags);
+
+            const Trade trade{9, 99.0, 5};
+            const bool written = rb.try_write(&trade, sizeof(trade), header, type_id_v<Trade>);
+            const bool untyped = rb.try_write(&trade, sizeof(trade), header);
+            assert(written && untyped);
+            (void)written; // Mark as used
+            (void)untyped; // Mark as used
+
+            uint32_t ids[2] = {};
+            size_t count = 0;
+            rb.read_batch(2, [&](std::span<const uint8_t>) {
+                ids[count++] = rb.last_type_id();
+            }, header);
+            assert(count == 2 && ids[0] == type_id_v<Trade> && ids[1] == 0);
+            (void)ids; // Mark as used
+        }
+
+        // Compact records without TypeIds have no room for one
+        assert(RecordLayout::for_flags(compact).type_id_offset == 0);
+
+        std::cout << "  [PASS] Record type id test passed\n";
+    }
+
+    std::cout << "\nAll dispatch tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <swiftchannel/common/numa.hpp>
+#include <swiftchannel/sender/config.hpp>
+#include <iostream>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace swiftchannel;
+
+// Simple test harness
+int main() {
+    std::cout << "Running NUMA placement tests...\n";
+
+    const auto page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    const size_t size = 64 * page;
+    void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    assert(memory != MAP_FAILED);
+
+    // Test 1: Nothing is placed before it is touched
+    {
+        const PagePlacement placement = page_placement(memory, size);
+        size_t placed = 0;
+        for (size_t pages : placement.pages_per_node) {
+            placed += pages;
+        }
+        assert(placed == 0 && placement.not_present == size / page);
+        (void)placed; // Mark as used
+
+        std::cout << "  [PASS] Untouched memory test passed\n";
+    }
+
+    // Test 2: Bound pages land on the requested node
+    {
+        const int node = current_numa_node();
+        const int result = apply_numa_policy(memory, size, NumaPolicy::Bind, node);
+        assert(result == 0 && "Binding to our own node should succeed");
+        (void)result; // Mark as used
+
+        std::memset(memory, 0xAB, size);
+        const PagePlacement placement = page_placement(memory, size);
+        assert(placement.not_present == 0);
+        assert(placement.pages_per_node.size() == static_cast<size_t>(node) + 1 &&
+               placement.pages_per_node[node] == size / page);
+
+        std::cout << "  [PASS] Bind test passed (node " << node << ")\n";
+    }
+
+    // Test 3: Interleave and bad nodes
+    {
+        const int interleave = apply_numa_policy(memory, size, NumaPolicy::Interleave, 0);
+        const int bad = apply_numa_policy(memory, size, NumaPolicy::Bind, MAX_NUMA_NODES);
+        assert(interleave == 0 && bad == EINVAL);
+        (void)interleave; // Mark as used
+        (void)bad;
+
+        ChannelConfig config;
+        config.numa_policy = NumaPolicy::Bind;
+        config.numa_node = -1;
+        assert(!config.is_valid() && "Bind needs a node");
+
+        std::cout << "  [PASS] Policy validation test passed\n";
+    }
+
+    ::munmap(memory, size);
+
+    std::cout << "All NUMA placement tests passed!\n";
+    return 0;
+}
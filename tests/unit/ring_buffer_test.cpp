@@ -3,6 +3,11 @@
 #include <iostream>
 #include <cstring>
 #include <cassert>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
 
 using namespace swiftchannel;
 
@@ -69,6 +74,668 @@ int main() {
         std::cout << "  [PASS] Buffer full detection test passed (wrote " << write_count << " messages)\n";
     }
 
+    // Test 3: Zero-copy reserve/commit
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)];
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        header->write_index.store(0, std::memory_order_release);
+        header->read_index.store(0, std::memory_order_release);
+
+        void* ring_memory = memory + sizeof(SharedMemoryHeader);
+        RingBuffer rb(ring_memory, buffer_size);
+
+        // Reserve more than needed, commit only what was written
+        std::span<uint8_t> payload;
+        bool reserve_result = rb.try_reserve(128, payload, header);
+        assert(reserve_result && "Reserve should succeed");
+        assert(payload.size() == 128 && "Span should cover the reservation");
+        assert(rb.available_read_data(header) == 0 && "Nothing visible before commit");
+        (void)reserve_result; // Mark as used
+
+        const char* test_data = "in-place";
+        std::memcpy(payload.data(), test_data, strlen(test_data) + 1);
+        rb.commit(strlen(test_data) + 1, header);
+
+        assert(rb.available_read_data(header) == rb.record_size(strlen(test_data) + 1));
+
+        char read_buffer[256];
+        size_t read_size = sizeof(read_buffer);
+        bool read_result = rb.try_read(read_buffer, read_size, header);
+        assert(read_result && "Read should succeed");
+        assert(read_size == strlen(test_data) + 1 && "Committed size should be used");
+        assert(strcmp(read_buffer, test_data) == 0 && "Data should match");
+        (void)read_result; // Mark as used
+
+        std::cout << "  [PASS] Reserve/commit test passed\n";
+    }
+
+    // Test 4: Wrap-around keeps records contiguous
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)];
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        header->write_index.store(0, std::memory_order_release);
+        header->read_index.store(0, std::memory_order_release);
+
+        void* ring_memory = memory + sizeof(SharedMemoryHeader);
+        RingBuffer rb(ring_memory, buffer_size);
+
+        // Odd-sized messages so that record boundaries drift across the end
+        char data[300];
+        char read_buffer[300];
+        for (int i = 0; i < 200; ++i) {
+            const size_t len = 1 + static_cast<size_t>(i * 37) % sizeof(data);
+            memset(data, 'a' + (i % 26), len);
+
+            bool write_result = rb.try_write(data, len, header);
+            assert(write_result && "Write should succeed after reads");
+            (void)write_result; // Mark as used
+
+            size_t read_size = sizeof(read_buffer);
+            bool read_result = rb.try_read(read_buffer, read_size, header);
+            assert(read_result && read_size == len && "Read should return the message");
+            assert(memcmp(read_buffer, data, len) == 0 && "Data should match");
+            (void)read_result; // Mark as used
+        }
+
+        assert(header->write_index.load() > buffer_size && "Test should wrap");
+        assert(rb.available_read_data(header) == 0 && "Buffer should be drained");
+
+        std::cout << "  [PASS] Wrap-around test passed\n";
+    }
+
+    // Test 5: Zero-copy peek/release
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)];
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        header->write_index.store(0, std::memory_order_release);
+        header->read_index.store(0, std::memory_order_release);
+
+        void* ring_memory = memory + sizeof(SharedMemoryHeader);
+        RingBuffer rb(ring_memory, buffer_size);
+
+        const char* test_data = "peek me";
+        bool write_result = rb.try_write(test_data, strlen(test_data) + 1, header);
+        assert(write_result && "Write should succeed");
+        (void)write_result; // Mark as used
+
+        std::span<const uint8_t> view;
+        bool peek_result = rb.try_peek(view, header);
+        assert(peek_result && "Peek should succeed");
+        assert(view.size() == strlen(test_data) + 1 && "Size should match");
+        assert(view.data() >= static_cast<const uint8_t*>(ring_memory) &&
+               view.data() < static_cast<const uint8_t*>(ring_memory) + buffer_size &&
+               "View should point into the ring");
+        assert(strcmp(reinterpret_cast<const char*>(view.data()), test_data) == 0);
+        (void)peek_result; // Mark as used
+
+        // Space is not reclaimed until release
+        assert(rb.available_read_data(header) != 0 && "Peek must not consume");
+        rb.release(header);
+        assert(rb.available_read_data(header) == 0 && "Release should consume");
+
+        std::cout << "  [PASS] Peek/release test passed\n";
+    }
+
+    // Test 6: Batched write with a single publish
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)];
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        header->write_index.store(0, std::memory_order_release);
+        header->read_index.store(0, std::memory_order_release);
+
+        void* ring_memory = memory + sizeof(SharedMemoryHeader);
+        RingBuffer rb(ring_memory, buffer_size);
+
+        uint64_t values[200];
+        for (uint64_t i = 0; i < 200; ++i) {
+            values[i] = i;
+        }
+        auto payload_at = [&](size_t i) {
+            return std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(&values[i]),
+                                            sizeof(uint64_t));
+        };
+
+        // 200 * 40 bytes does not fit in 4096: all-or-nothing publishes nothing
+        size_t written = rb.try_write_batch(200, payload_at, header, true);
+        assert(written == 0 && "All-or-nothing batch should not be published");
+        assert(rb.available_read_data(header) == 0 && "Nothing should be visible");
+
+        // Partial mode publishes as many as fit
+        written = rb.try_write_batch(200, payload_at, header);
+        assert(written == buffer_size / rb.record_size(sizeof(uint64_t)));
+
+        for (size_t i = 0; i < written; ++i) {
+            uint64_t value = 0;
+            size_t read_size = sizeof(value);
+            bool read_result = rb.try_read(&value, read_size, header);
+            assert(read_result && value == i && "Batch should be read back in order");
+            (void)read_result; // Mark as used
+        }
+        (void)written; // Mark as used
+
+        std::cout << "  [PASS] Batched write test passed\n";
+    }
+
+    // Test 7: Batched read with a single read_index publish
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)];
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        header->write_index.store(0, std::memory_order_release);
+        header->read_index.store(0, std::memory_order_release);
+
+        void* ring_memory = memory + sizeof(SharedMemoryHeader);
+        RingBuffer rb(ring_memory, buffer_size);
+
+        for (uint32_t i = 0; i < 10; ++i) {
+            bool write_result = rb.try_write(&i, sizeof(i), header);
+            assert(write_result && "Write should succeed");
+            (void)write_result; // Mark as used
+        }
+
+        // Peeked messages stay in the ring until release
+        uint32_t expected = 0;
+        size_t count = rb.peek_batch(4, [&](std::span<const uint8_t> payload) {
+            uint32_t value = 0;
+            std::memcpy(&value, payload.data(), sizeof(value));
+            assert(value == expected++ && "Batch should be in order");
+        }, header);
+        assert(count == 4 && "Batch should stop at max_messages");
+        (void)expected; // Mark as used
+        assert(header->read_index.load() == 0 && "Peek must not publish read_index");
+
+        rb.release(header);
+        assert(header->read_index.load() == 4 * rb.record_size(sizeof(uint32_t)));
+
+        count = rb.read_batch(100, [&](std::span<const uint8_t> payload) {
+            uint32_t value = 0;
+            std::memcpy(&value, payload.data(), sizeof(value));
+            assert(value == expected++ && "Batch should be in order");
+        }, header);
+        assert(count == 6 && "Batch should stop at the write_index snapshot");
+        assert(rb.available_read_data(header) == 0 && "Buffer should be drained");
+        (void)count; // Mark as used
+
+        std::cout << "  [PASS] Batched read test passed\n";
+    }
+
+    // Test 8: Multi-producer records become visible in ring order
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)] = {};
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        header->write_index.store(0, std::memory_order_release);
+        header->read_index.store(0, std::memory_order_release);
+
+        void* ring_memory = memory + sizeof(SharedMemoryHeader);
+        const auto flags = static_cast<uint64_t>(ChannelFlags::MultiProducer);
+        RingBuffer producer_a(ring_memory, buffer_size, flags);
+        RingBuffer producer_b(ring_memory, buffer_size, flags);
+        RingBuffer consumer(ring_memory, buffer_size, flags);
+
+        std::span<uint8_t> slot_a;
+        std::span<uint8_t> slot_b;
+        bool reserve_a = producer_a.try_reserve(64, slot_a, header);
+        bool reserve_b = producer_b.try_reserve(8, slot_b, header);
+        assert(reserve_a && reserve_b && "Both producers should claim space");
+        (void)reserve_a; (void)reserve_b; // Mark as used
+
+        // B finishes first, but A's slot comes first in the ring
+        std::memcpy(slot_b.data(), "B", 2);
+        producer_b.commit(2, header);
+
+        char read_buffer[64];
+        size_t read_size = sizeof(read_buffer);
+        bool read_result = consumer.try_read(read_buffer, read_size, header);
+        assert(!read_result && "Uncommitted slot must block the consumer");
+
+        // A commits less than it reserved; the rest becomes padding
+        std::memcpy(slot_a.data(), "A", 2);
+        producer_a.commit(2, header);
+
+        read_size = sizeof(read_buffer);
+        read_result = consumer.try_read(read_buffer, read_size, header);
+        assert(read_result && strcmp(read_buffer, "A") == 0 && "A should be read first");
+
+        read_size = sizeof(read_buffer);
+        read_result = consumer.try_read(read_buffer, read_size, header);
+        assert(read_result && strcmp(read_buffer, "B") == 0 && "B should be read second");
+        assert(consumer.available_read_data(header) == 0 && "Buffer should be drained");
+        (void)read_result; // Mark as used
+
+        std::cout << "  [PASS] Multi-producer commit order test passed\n";
+    }
+
+    // Test 9: Concurrent producers never corrupt each other
+    {
+        constexpr size_t buffer_size = 4096;
+        constexpr int producers = 4;
+        constexpr uint32_t per_producer = 20000;
+        alignas(CACHE_LINE_SIZE) static uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)] = {};
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        header->write_index.store(0, std::memory_order_release);
+        header->read_index.store(0, std::memory_order_release);
+
+        void* ring_memory = memory + sizeof(SharedMemoryHeader);
+        const auto flags = static_cast<uint64_t>(ChannelFlags::MultiProducer);
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([=]() {
+                RingBuffer rb(ring_memory, buffer_size, flags);
+                // Variable sizes so records land at every offset
+                uint32_t message[16] = {};
+                for (uint32_t i = 0; i < per_producer;) {
+                    message[0] = static_cast<uint32_t>(p);
+                    message[1] = i;
+                    const size_t words = 2 + i % 14;
+                    for (size_t w = 2; w < words; ++w) {
+                        message[w] = i ^ static_cast<uint32_t>(w);
+                    }
+                    if (rb.try_write(message, words * sizeof(uint32_t), header)) {
+                        ++i;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        RingBuffer consumer(ring_memory, buffer_size, flags);
+        uint32_t next[producers] = {};
+        uint32_t total = 0;
+        bool valid = true;
+
+        while (total < producers * per_producer) {
+            uint32_t message[16];
+            size_t read_size = sizeof(message);
+            if (!consumer.try_read(message, read_size, header)) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            const uint32_t p = message[0];
+            const uint32_t i = message[1];
+            valid = valid && p < producers && i == next[p] &&
+                    read_size == (2 + i % 14) * sizeof(uint32_t);
+            for (size_t w = 2; valid && w < read_size / sizeof(uint32_t); ++w) {
+                valid = message[w] == (i ^ static_cast<uint32_t>(w));
+            }
+            if (p < producers) {
+                next[p] = i + 1;
+            }
+            ++total;
+        }
+
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        assert(valid && "Every message should arrive intact and in per-producer order");
+        (void)valid; // Mark as used
+
+        std::cout << "  [PASS] Concurrent multi-producer test passed ("
+                  << total << " messages)\n";
+    }
+
+    // Test 10: Broadcast consumers each see every message
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) static uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)] = {};
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        header->write_index.store(0, std::memory_order_release);
+        header->read_index.store(0, std::memory_order_release);
+
+        void* ring_memory = memory + sizeof(SharedMemoryHeader);
+        const auto flags = static_cast<uint64_t>(ChannelFlags::Broadcast);
+
+        RingBuffer producer(ring_memory, buffer_size, flags);
+        RingBuffer fast(ring_memory, buffer_size, flags);
+        RingBuffer slow(ring_memory, buffer_size, flags);
+        const auto self = static_cast<uint32_t>(::getpid());
+        bool attached = fast.attach_consumer(header, self);
+        attached = slow.attach_consumer(header, self) && attached;
+        assert(attached && "Both consumers should get a cursor");
+        (void)attached; // Mark as used
+
+        // Fill the ring; the slow consumer alone must gate the producer
+        uint64_t message[8] = {};
+        uint64_t written = 0;
+        while (producer.try_write(message, sizeof(message), header)) {
+            message[0] = ++written;
+        }
+        assert(written > 0);
+
+        uint64_t received[8];
+        size_t read_size = sizeof(received);
+        uint64_t fast_count = 0;
+        while (fast.try_read(received, read_size, header)) {
+            assert(received[0] == fast_count);
+            ++fast_count;
+            read_size = sizeof(received);
+        }
+        assert(fast_count == written);
+        (void)fast_count; // Mark as used
+
+        bool wrote = producer.try_write(message, sizeof(message), header);
+        assert(!wrote && "Slow consumer should still hold the ring full");
+
+        read_size = sizeof(received);
+        bool read = slow.try_read(received, read_size, header);
+        assert(read && received[0] == 0);
+        (void)read; // Mark as used
+
+        wrote = producer.try_write(message, sizeof(message), header);
+        assert(wrote && "Slow consumer progress should free space");
+        (void)wrote; // Mark as used
+
+        // A detached consumer no longer holds the producer back
+        fast.detach_consumer();
+        slow.detach_consumer();
+        assert(producer.available_write_space(header) == buffer_size);
+
+        // Consumers that die without detaching leave their cursors behind
+        const pid_t child = ::fork();
+        if (child == 0) {
+            ::_exit(0);
+        }
+        ::waitpid(child, nullptr, 0);
+        const auto dead = static_cast<uint32_t>(child);
+        for (size_t i = 0; i < MAX_BROADCAST_CONSUMERS; ++i) {
+            RingBuffer crashed(ring_memory, buffer_size, flags);
+            attached = crashed.attach_consumer(header, dead);
+            assert(attached);
+        }
+
+        // A new consumer takes one of them back
+        RingBuffer late(ring_memory, buffer_size, flags);
+        attached = late.attach_consumer(header, self);
+        assert(attached && "Dead consumers' cursors should be reclaimed");
+        late.detach_consumer();
+
+        // The producer stalls behind a dead consumer only until it checks
+        {
+            RingBuffer crashed(ring_memory, buffer_size, flags);
+            attached = crashed.attach_consumer(header, dead);
+            assert(attached);
+        }
+        const size_t capacity = buffer_size / (sizeof(MessageHeader) + sizeof(message));
+        size_t accepted = 0;
+        for (size_t i = 0; i < 4 * capacity; ++i) {
+            accepted += producer.try_write(message, sizeof(message), header) ? 1 : 0;
+        }
+        assert(accepted > capacity && "A dead consumer must not hold the ring");
+        (void)accepted; // Mark as used
+
+        std::cout << "  [PASS] Broadcast consumer test passed\n";
+    }
+
+    // Test 11: Overwrite mode never blocks the producer
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) static uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)] = {};
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        header->write_index.store(0, std::memory_order_release);
+        header->oldest_index.store(0, std::memory_order_release);
+        header->read_index.store(0, std::memory_order_release);
+
+        void* ring_memory = memory + sizeof(SharedMemoryHeader);
+        const auto flags = static_cast<uint64_t>(ChannelFlags::Overwrite);
+
+        RingBuffer producer(ring_memory, buffer_size, flags);
+        RingBuffer consumer(ring_memory, buffer_size, flags);
+
+        // Several laps with nobody reading
+        constexpr uint64_t total = 1000;
+        bool all_written = true;
+        for (uint64_t i = 0; i < total; ++i) {
+            uint64_t message[4] = {i, i, i, i};
+            all_written = producer.try_write(message, sizeof(message), header) && all_written;
+        }
+        assert(all_written && "Overwrite mode should never report full");
+        (void)all_written; // Mark as used
+
+        // The consumer resyncs to the oldest intact record and reads the tail
+        uint64_t received[4];
+        size_t read_size = sizeof(received);
+        uint64_t expected = 0;
+        uint64_t count = 0;
+        while (consumer.try_read(received, read_size, header)) {
+            if (count == 0) {
+                expected = received[0];
+            }
+            assert(received[0] == expected && received[3] == expected);
+            ++expected;
+            ++count;
+            read_size = sizeof(received);
+        }
+
+        assert(expected == total && "Consumer should end at the newest message");
+        assert(count > 0 && count < total);
+        assert(consumer.overruns() == 1);
+        (void)count; // Mark as used
+
+        std::cout << "  [PASS] Overwrite lap test passed (" << count
+                  << " of " << total << " kept)\n";
+    }
+
+    // Test 12: A lapped concurrent reader never sees a torn message
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) static uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)] = {};
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        header->write_index.store(0, std::memory_order_release);
+        header->oldest_index.store(0, std::memory_order_release);
+        header->read_index.store(0, std::memory_order_release);
+
+        void* ring_memory = memory + sizeof(SharedMemoryHeader);
+        const auto flags = static_cast<uint64_t>(ChannelFlags::Overwrite);
+        constexpr uint64_t total = 200000;
+
+        std::thread writer([=]() {
+            RingBuffer producer(ring_memory, buffer_size, flags);
+            uint64_t message[32];
+            for (uint64_t i = 0; i < total; ++i) {
+                const size_t words = 1 + i % 32;
+                std::fill(message, message + words, i);
+                [[maybe_unused]] bool written =
+                    producer.try_write(message, words * sizeof(uint64_t), header);
+            }
+        });
+
+        RingBuffer consumer(ring_memory, buffer_size, flags);
+        uint64_t received[32];
+        uint64_t last = 0;
+        uint64_t count = 0;
+        bool valid = true;
+
+        while (last + 1 < total) {
+            size_t read_size = sizeof(received);
+            if (!consumer.try_read(received, read_size, header)) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            const uint64_t id = received[0];
+            valid = valid && (count == 0 || id > last) &&
+                    read_size == (1 + id % 32) * sizeof(uint64_t);
+            for (size_t w = 1; valid && w < read_size / sizeof(uint64_t); ++w) {
+                valid = received[w] == id;
+            }
+            last = id;
+            ++count;
+        }
+
+        writer.join();
+
+        assert(valid && "Every message read should be intact and in order");
+        (void)valid; // Mark as used
+
+        std::cout << "  [PASS] Concurrent overwrite test passed (" << count
+                  << " read, " << consumer.overruns() << " overruns)\n";
+    }
+
+    // Test 13: Corrupted payloads are dropped and counted
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) static uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)] = {};
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        header->write_index.store(0, std::memory_order_release);
+        header->read_index.store(0, std::memory_order_release);
+
+        uint8_t* ring_memory = memory + sizeof(SharedMemoryHeader);
+        const auto flags = static_cast<uint64_t>(ChannelFlags::Checksum);
+
+        RingBuffer producer(ring_memory, buffer_size, flags);
+        RingBuffer consumer(ring_memory, buffer_size, flags);
+
+        const char first[] = "first message";
+        const char second[] = "second message";
+        bool written = producer.try_write(first, sizeof(first), header);
+        written = producer.try_write(second, sizeof(second), header) && written;
+
+        // The reserve/commit path checksums what was written in place
+        std::span<uint8_t> slot;
+        written = producer.try_reserve(16, slot, header) && written;
+        std::memcpy(slot.data(), "third message", 14);
+        producer.commit(14, header);
+        assert(written);
+        (void)written; // Mark as used
+
+        const auto* record = reinterpret_cast<const MessageHeader*>(ring_memory);
+        assert(record->checksum == crc32c(first, sizeof(first)));
+        (void)record; // Mark as used
+
+        // Flip one payload bit of the first message
+        ring_memory[sizeof(MessageHeader) + 3] ^= 0x10;
+
+        char received[64];
+        size_t read_size = sizeof(received);
+        bool read = consumer.try_read(received, read_size, header);
+        assert(read && std::strcmp(received, second) == 0);
+        assert(consumer.checksum_mismatches() == 1);
+
+        std::span<const uint8_t> view;
+        read = consumer.try_peek(view, header);
+        assert(read && view.size() == 14 && std::memcmp(view.data(), "third message", 14) == 0);
+        consumer.release(header);
+        assert(consumer.checksum_mismatches() == 1);
+        (void)read; // Mark as used
+
+        std::cout << "  [PASS] Checksum verification test passed\n";
+    }
+
+    // Test 14: Compact framing carries only the fields a channel uses
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) static uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)];
+        std::memset(memory, 0, sizeof(memory));
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        uint8_t* ring_memory = memory + sizeof(SharedMemoryHeader);
+        const auto compact = static_cast<uint64_t>(ChannelFlags::CompactFraming);
+
+        // Bare records: magic and size only
+        const uint64_t bare = compact | static_cast<uint64_t>(ChannelFlags::NoTimestamp);
+        RingBuffer producer(ring_memory, buffer_size, bare);
+        RingBuffer consumer(ring_memory, buffer_size, bare);
+        assert(producer.record_size(16) == 24 && "16-byte payload should take 24 bytes");
+
+        // Several laps, so padding records are exercised too
+        bool match = true;
+        for (uint64_t i = 0; i < 1000; ++i) {
+            const uint64_t message[2] = {i, ~i};
+            bool written = producer.try_write(message, sizeof(message), header);
+            uint64_t received[2] = {};
+            size_t read_size = sizeof(received);
+            bool read = consumer.try_read(received, read_size, header);
+            match = match && written && read && read_size == sizeof(message) &&
+                    received[0] == i && received[1] == ~i;
+        }
+        assert(match && "Compact records should round-trip");
+        (void)match; // Mark as used
+
+        // Checksum and overwrite fields are still carried when enabled
+        std::memset(memory, 0, sizeof(memory));
+        const uint64_t full = compact | static_cast<uint64_t>(ChannelFlags::Checksum) |
+                              static_cast<uint64_t>(ChannelFlags::Overwrite);
+        RingBuffer lossy_producer(ring_memory, buffer_size, full);
+        RingBuffer lossy_consumer(ring_memory, buffer_size, full);
+        assert(lossy_producer.layout().header_size == sizeof(MessageHeader));
+
+        const uint64_t value = 7;
+        bool written = lossy_producer.try_write(&value, sizeof(value), header);
+        ring_memory[lossy_producer.layout().header_size] ^= 0x01;
+        written = lossy_producer.try_write(&value, sizeof(value), header) && written;
+
+        uint64_t received = 0;
+        size_t read_size = sizeof(received);
+        bool read = lossy_consumer.try_read(&received, read_size, header);
+        assert(written && read && received == value);
+        assert(lossy_consumer.checksum_mismatches() == 1);
+        (void)written; // Mark as used
+        (void)read;
+
+        std::cout << "  [PASS] Compact framing test passed\n";
+    }
+
+    // Test 15: peek_from looks past held messages; release_to frees a prefix
+    {
+        constexpr size_t buffer_size = 4096;
+        alignas(CACHE_LINE_SIZE) uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)] = {};
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        RingBuffer rb(memory + sizeof(SharedMemoryHeader), buffer_size);
+
+        for (uint64_t i = 0; i < 3; ++i) {
+            bool written = rb.try_write(&i, sizeof(i), header);
+            assert(written);
+            (void)written; // Mark as used
+        }
+
+        uint64_t scan = rb.read_cursor(header);
+        uint64_t ends[3] = {};
+        uint64_t values[3] = {};
+        size_t count = 0;
+        auto record = [&](std::span<const uint8_t> payload, uint64_t end) {
+            std::memcpy(&values[count], payload.data(), sizeof(uint64_t));
+            ends[count++] = end;
+        };
+        const size_t first = rb.peek_from(scan, 2, record, header);
+        const size_t rest = rb.peek_from(scan, 8, record, header);
+        assert(first == 2 && rest == 1);
+        (void)first; // Mark as used
+        (void)rest;
+        assert(count == 3 && values[0] == 0 && values[1] == 1 && values[2] == 2);
+        assert(ends[0] < ends[1] && ends[1] < ends[2] && scan == ends[2]);
+
+        // Nothing is consumed until released, and then only up to the end given
+        assert(rb.read_cursor(header) == 0);
+        rb.release_to(ends[0], header);
+        uint64_t next = 0;
+        size_t read_size = sizeof(next);
+        bool read = rb.try_read(&next, read_size, header);
+        assert(read && next == 1 && rb.read_cursor(header) == ends[1]);
+        (void)count; // Mark as used
+        (void)read;
+
+        std::cout << "  [PASS] Peek-ahead test passed\n";
+    }
+
     std::cout << "All ring buffer tests passed!\n";
     return 0;
 }
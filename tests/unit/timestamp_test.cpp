@@ -0,0 +1,97 @@
+#include <swiftchannel/common/timestamp.hpp>
+#include <swiftchannel/sender/ring_buffer.hpp>
+#include <swiftchannel/common/types.hpp>
+#include <iostream>
+#include <cassert>
+#include <cstring>
+
+using namespace swiftchannel;
+
+namespace {
+
+// Write one message with the given flags and return its stamp in steady_clock ns
+uint64_t stamp_one(uint64_t flags, const TscCalibration& calibration = {}) {
+    constexpr size_t buffer_size = 4096;
+    alignas(CACHE_LINE_SIZE) static uint8_t memory[buffer_size + sizeof(SharedMemoryHeader)];
+    std::memset(memory, 0, sizeof(memory));
+
+    auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+    header->flags = flags;
+    header->tsc = calibration;
+
+    void* ring_memory = memory + sizeof(SharedMemoryHeader);
+    RingBuffer producer(ring_memory, buffer_size, flags);
+    RingBuffer consumer(ring_memory, buffer_size, flags);
+
+    const uint64_t value = 42;
+    bool written = producer.try_write(&value, sizeof(value), header);
+    uint64_t received = 0;
+    size_t size = sizeof(received);
+    bool read = consumer.try_read(&received, size, header);
+    assert(written && read);
+    (void)written; // Mark as used
+    (void)read;
+
+    return to_steady_ns(header, consumer.last_timestamp());
+}
+
+// Distance between two nanosecond stamps
+[[maybe_unused]] uint64_t distance(uint64_t a, uint64_t b) {
+    return a > b ? a - b : b - a;
+}
+
+} // namespace
+
+// Simple test harness
+int main() {
+    std::cout << "Running timestamp tests...\n";
+
+    // Test 1: steady_clock stamps (default)
+    {
+        const uint64_t before = steady_now_ns();
+        const uint64_t stamp = stamp_one(0);
+        const uint64_t after = steady_now_ns();
+        assert(before <= stamp && stamp <= after);
+        (void)before; // Mark as used
+        (void)stamp;
+        (void)after;
+
+        std::cout << "  [PASS] Steady clock timestamp test passed\n";
+    }
+
+    // Test 2: Coarse stamps share steady_clock's epoch
+    {
+        const uint64_t stamp = stamp_one(static_cast<uint64_t>(ChannelFlags::CoarseTimestamp));
+        assert(stamp != 0 && distance(stamp, steady_now_ns()) < 100000000);  // 100 ms
+        (void)stamp; // Mark as used
+
+        std::cout << "  [PASS] Coarse timestamp test passed\n";
+    }
+
+    // Test 3: Timestamps turned off
+    {
+        const uint64_t stamp = stamp_one(static_cast<uint64_t>(ChannelFlags::NoTimestamp));
+        assert(stamp == 0);
+        (void)stamp; // Mark as used
+
+        std::cout << "  [PASS] Disabled timestamp test passed\n";
+    }
+
+    // Test 4: TSC ticks convert back to steady_clock time
+    if (tsc_is_invariant()) {
+        const TscCalibration calibration = calibrate_tsc(2000000);
+        assert(calibration.mult != 0);
+
+        const uint64_t stamp = stamp_one(static_cast<uint64_t>(ChannelFlags::TscTimestamp),
+                                         calibration);
+        assert(distance(stamp, steady_now_ns()) < 1000000);  // 1 ms
+        (void)stamp; // Mark as used
+
+        std::cout << "  [PASS] TSC timestamp test passed\n";
+    } else {
+        std::cout << "  [SKIP] TSC timestamp test (no invariant TSC)\n";
+    }
+
+    std::cout << "All timestamp tests passed!\n";
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include <swiftchannel/sender/typed_ring_buffer.hpp>
+#include <swiftchannel/sender/typed_sender.hpp>
+#include <swiftchannel/receiver/typed_receiver.hpp>
+#include <swiftchannel/common/types.hpp>
+#include <iostream>
+#include <cassert>
+#include <thread>
+
+using namespace swiftchannel;
+
+struct Tick {
+    uint64_t sequence;
+    double price;
+    uint32_t quantity;
+    uint32_t flags;
+};
+
+static_assert(sizeof(Tick) == 24);
+
+// Simple test harness
+int main() {
+    std::cout << "Running typed ring buffer tests...\n";
+
+    // Test 1: Fill, drain and wrap around
+    {
+        using Ring = TypedRingBuffer<Tick, 8>;
+        alignas(CACHE_LINE_SIZE) static uint8_t memory[sizeof(SharedMemoryHeader) + Ring::ring_size] = {};
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        Ring producer(memory + sizeof(SharedMemoryHeader));
+        Ring consumer(memory + sizeof(SharedMemoryHeader));
+
+        uint64_t next_write = 0;
+        uint64_t next_read = 0;
+        bool valid = true;
+
+        for (int round = 0; round < 3; ++round) {
+            while (producer.try_write(Tick{next_write, 1.5, 10, 0}, header)) {
+                ++next_write;
+            }
+            valid = valid && next_write - next_read == Ring::capacity;
+
+            Tick tick{};
+            while (consumer.try_read(tick, header)) {
+                valid = valid && tick.sequence == next_read;
+                ++next_read;
+            }
+            valid = valid && next_read == next_write;
+        }
+
+        assert(valid && "Slots should come back in order across wrap-arounds");
+        (void)valid; // Mark as used
+
+        std::cout << "  [PASS] Fill/drain wrap-around test passed\n";
+    }
+
+    // Test 2: Batched write and read with one publish each
+    {
+        using Ring = TypedRingBuffer<Tick, 16>;
+        alignas(CACHE_LINE_SIZE) static uint8_t memory[sizeof(SharedMemoryHeader) + Ring::ring_size] = {};
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        Ring producer(memory + sizeof(SharedMemoryHeader));
+        Ring consumer(memory + sizeof(SharedMemoryHeader));
+
+        // Offset the indices so the batch straddles the end of the array
+        Tick ticks[12] = {};
+        for (uint64_t i = 0; i < 12; ++i) {
+            ticks[i].sequence = i;
+        }
+        size_t written = producer.try_write_batch(std::span<const Tick>(ticks, 10), header);
+        size_t read = consumer.read_batch(10, [](const Tick&) {}, header);
+        assert(written == 10 && read == 10);
+
+        // All-or-nothing refuses a batch larger than the free space
+        written = producer.try_write_batch(std::span<const Tick>(ticks, 12), header);
+        assert(written == 12);
+        written = producer.try_write_batch(std::span<const Tick>(ticks, 12), header, true);
+        assert(written == 0);
+        written = producer.try_write_batch(std::span<const Tick>(ticks, 12), header);
+        assert(written == 4);
+
+        uint64_t expected = 0;
+        bool in_order = true;
+        read = consumer.read_batch(100, [&](const Tick& tick) {
+            in_order = in_order && tick.sequence == expected % 12;
+            ++expected;
+        }, header);
+
+        assert(read == 16 && in_order);
+        assert(header->read_index.load() == 26 && header->write_index.load() == 26);
+        (void)written; // Mark as used
+        (void)read;
+
+        std::cout << "  [PASS] Batched write/read test passed\n";
+    }
+
+    // Test 3: Producer and consumer threads
+    {
+        using Ring = TypedRingBuffer<Tick, 64>;
+        alignas(CACHE_LINE_SIZE) static uint8_t memory[sizeof(SharedMemoryHeader) + Ring::ring_size] = {};
+
+        auto* header = reinterpret_cast<SharedMemoryHeader*>(memory);
+        constexpr uint64_t total = 200000;
+
+        std::thread writer([&]() {
+            Ring producer(memory + sizeof(SharedMemoryHeader));
+            for (uint64_t i = 0; i < total;) {
+                if (producer.try_write(Tick{i, 0.0, static_cast<uint32_t>(i), 0}, header)) {
+                    ++i;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        Ring consumer(memory + sizeof(SharedMemoryHeader));
+        uint64_t received = 0;
+        bool valid = true;
+        while (received < total) {
+            const size_t count = consumer.read_batch(32, [&](const Tick& tick) {
+                valid = valid && tick.sequence == received &&
+                        tick.quantity == static_cast<uint32_t>(received);
+                ++received;
+            }, header);
+            if (count == 0) {
+                std::this_thread::yield();
+            }
+        }
+
+        writer.join();
+        assert(valid && "Every value should arrive intact and in order");
+        (void)valid; // Mark as used
+
+        std::cout << "  [PASS] Concurrent typed test passed\n";
+    }
+
+    // Test 4: TypedSender/TypedReceiver over shared memory
+    {
+        const std::string channel_name = "test_typed_channel";
+        TypedReceiver<Tick, 256> receiver(channel_name);
+        TypedSender<Tick, 256> sender(channel_name);
+        assert(receiver.is_ready() && sender.is_ready());
+
+        // Skip anything left over from a previous run
+        while (receiver.drain(1024, [](const Tick&) {}).value_or(0) != 0) {}
+
+        bool sent = sender.send(Tick{7, 2.5, 100, 0}).is_ok();
+        Tick batch[3] = {{8, 0.0, 0, 0}, {9, 0.0, 0, 0}, {10, 0.0, 0, 0}};
+        sent = sender.send_batch(batch).value_or(0) == 3 && sent;
+        assert(sent);
+        (void)sent; // Mark as used
+
+        Tick first{};
+        bool got = receiver.try_receive(first).value_or(false);
+        assert(got && first.sequence == 7 && first.quantity == 100);
+        (void)got;
+
+        uint64_t expected = 8;
+        auto drained = receiver.drain(10, [&](const Tick& tick) {
+            expected += (tick.sequence == expected) ? 1 : 0;
+        });
+        assert(drained.value_or(0) == 3 && expected == 11);
+        (void)drained;
+
+        // A different slot type must not attach to the same channel
+        TypedReceiver<uint64_t, 256> mismatched(channel_name);
+        assert(!mismatched.is_ready());
+
+        // Nor the same type with a different capacity (a different mask)
+        TypedReceiver<Tick, 128> smaller(channel_name);
+        TypedReceiver<Tick, 1024> larger(channel_name);
+        assert(!smaller.is_ready() && !larger.is_ready());
+        const bool still_sent = sender.send(Tick{11, 0.0, 0, 0}).is_ok();
+        assert(still_sent);
+        (void)still_sent; // Mark as used
+
+        std::cout << "  [PASS] Typed sender/receiver test passed\n";
+    }
+
+    std::cout << "All typed ring buffer tests passed!\n";
+    return 0;
+}